@@ -30,7 +30,11 @@ namespace catapult { namespace addressextraction {
 
 	namespace {
 		void RegisterExtension(extensions::ProcessBootstrapper& bootstrapper) {
-			auto pAddressExtractor = std::make_shared<AddressExtractor>(bootstrapper.pluginManager().createNotificationPublisher());
+			// extract addresses once (in parallel) so that all downstream subscribers can reuse them
+			auto* pExtractionPool = bootstrapper.pool().pushIsolatedPool("address extraction");
+			auto pAddressExtractor = std::make_shared<AddressExtractor>(
+					bootstrapper.pluginManager().createNotificationPublisher(),
+					*pExtractionPool);
 
 			// add a dummy service for extending service lifetimes
 			bootstrapper.extensionManager().addServiceRegistrar(extensions::CreateRootedServiceRegistrar(
@@ -22,13 +22,42 @@
 #include "AddressExtractor.h"
 #include "catapult/model/Elements.h"
 #include "catapult/model/TransactionUtils.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 
 namespace catapult { namespace addressextraction {
 
+	namespace {
+		// minimum number of transactions that are worth distributing across the pool
+		constexpr size_t Min_Parallel_Extraction_Count = 16;
+	}
+
 	AddressExtractor::AddressExtractor(std::unique_ptr<const model::NotificationPublisher>&& pPublisher)
 			: m_pPublisher(std::move(pPublisher))
+			, m_pPool(nullptr)
 	{}
 
+	AddressExtractor::AddressExtractor(std::unique_ptr<const model::NotificationPublisher>&& pPublisher, thread::IoThreadPool& pool)
+			: m_pPublisher(std::move(pPublisher))
+			, m_pPool(&pool)
+	{}
+
+	template<typename TItems, typename TAction>
+	void AddressExtractor::forEach(TItems& items, TAction action) const {
+		if (!m_pPool || items.size() < Min_Parallel_Extraction_Count) {
+			auto index = 0u;
+			for (auto& item : items)
+				action(item, index++);
+
+			return;
+		}
+
+		thread::ParallelFor(m_pPool->ioContext(), items, m_pPool->numWorkerThreads(), [action](auto& item, auto index) {
+			action(item, static_cast<uint32_t>(index));
+			return true;
+		}).get();
+	}
+
 	void AddressExtractor::extract(model::TransactionInfo& transactionInfo) const {
 		if (transactionInfo.OptionalExtractedAddresses)
 			return;
@@ -38,8 +67,16 @@ namespace catapult { namespace addressextraction {
 	}
 
 	void AddressExtractor::extract(model::TransactionInfosSet& transactionInfos) const {
-		for (auto& transactionInfo : transactionInfos)
-			extract(const_cast<model::TransactionInfo&>(transactionInfo));
+		// only distribute infos that require extraction
+		std::vector<model::TransactionInfo*> pendingTransactionInfos;
+		for (const auto& transactionInfo : transactionInfos) {
+			if (!transactionInfo.OptionalExtractedAddresses)
+				pendingTransactionInfos.push_back(const_cast<model::TransactionInfo*>(&transactionInfo));
+		}
+
+		forEach(pendingTransactionInfos, [this](auto* pTransactionInfo, auto) {
+			extract(*pTransactionInfo);
+		});
 	}
 
 	void AddressExtractor::extract(model::TransactionElement& transactionElement) const {
@@ -98,20 +135,18 @@ namespace catapult { namespace addressextraction {
 	}
 
 	void AddressExtractor::extract(model::BlockElement& blockElement) const {
-		auto primaryId = 1u; // transaction primary identifiers are 1-based
-
-		for (auto& transactionElement : blockElement.Transactions) {
+		const auto* pBlockStatement = blockElement.OptionalStatement.get();
+		forEach(blockElement.Transactions, [this, pBlockStatement](auto& transactionElement, auto index) {
 			extract(transactionElement);
 
-			if (blockElement.OptionalStatement) {
+			if (pBlockStatement) {
+				auto primaryId = index + 1; // transaction primary identifiers are 1-based
 				auto resolvedAddresses = FindResolvedAddresses(
-						blockElement.OptionalStatement->AddressResolutionStatements,
+						pBlockStatement->AddressResolutionStatements,
 						primaryId,
 						*transactionElement.OptionalExtractedAddresses);
 				UpdateExtractedAddresses(transactionElement, resolvedAddresses);
 			}
-
-			++primaryId;
-		}
+		});
 	}
 }}
@@ -28,16 +28,21 @@ namespace catapult {
 		struct BlockElement;
 		struct TransactionElement;
 	}
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace addressextraction {
 
 	/// Utility class for extracting addresses.
+	/// \note Addresses are extracted once and attached to the extracted entities so that all downstream subscribers can reuse them.
 	class AddressExtractor {
 	public:
 		/// Creates an extractor around \a pPublisher.
 		explicit AddressExtractor(std::unique_ptr<const model::NotificationPublisher>&& pPublisher);
 
+		/// Creates an extractor around \a pPublisher that uses \a pool to extract addresses of multiple transactions in parallel.
+		AddressExtractor(std::unique_ptr<const model::NotificationPublisher>&& pPublisher, thread::IoThreadPool& pool);
+
 	public:
 		/// Extracts transaction addresses into \a transactionInfo.
 		void extract(model::TransactionInfo& transactionInfo) const;
@@ -51,7 +56,12 @@ namespace catapult { namespace addressextraction {
 		/// Extracts transaction addresses into \a blockElement.
 		void extract(model::BlockElement& blockElement) const;
 
+	private:
+		template<typename TItems, typename TAction>
+		void forEach(TItems& items, TAction action) const;
+
 	private:
 		std::unique_ptr<const model::NotificationPublisher> m_pPublisher;
+		thread::IoThreadPool* m_pPool;
 	};
 }}
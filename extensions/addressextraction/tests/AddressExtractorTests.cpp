@@ -21,6 +21,8 @@
 
 #include "addressextraction/src/AddressExtractor.h"
 #include "catapult/model/Elements.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
 #include "tests/test/core/mocks/MockNotificationPublisher.h"
@@ -42,6 +44,12 @@ namespace catapult { namespace addressextraction {
 					, m_extractor(std::move(m_pNotificationPublisher))
 			{}
 
+			explicit TestContext(thread::IoThreadPool& pool)
+					: m_pNotificationPublisher(std::make_unique<mocks::MockNotificationPublisher>())
+					, m_notificationPublisher(*m_pNotificationPublisher)
+					, m_extractor(std::move(m_pNotificationPublisher), pool)
+			{}
+
 		public:
 			const auto& publisher() const {
 				return m_notificationPublisher;
@@ -126,6 +134,37 @@ namespace catapult { namespace addressextraction {
 		EXPECT_EQ(pAddresses3, transactionInfoSet.find(transactionInfos[3])->OptionalExtractedAddresses);
 	}
 
+	TEST(TEST_CLASS, ExtractDelegatesToPublisherOnlyWhenExtractionRequired_TransactionInfosSet_Parallel) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool(4);
+		TestContext context(*pPool);
+		auto pAddresses = std::make_shared<model::UnresolvedAddressSet>();
+
+		// - create 100 infos and only extract addresses of the odd ones
+		auto transactionInfos = test::CreateTransactionInfos(100);
+		for (auto i = 0u; i < transactionInfos.size(); ++i)
+			transactionInfos[i].OptionalExtractedAddresses = 0 == i % 2 ? pAddresses : nullptr;
+
+		auto transactionInfoSet = test::CopyTransactionInfosToSet(transactionInfos);
+
+		// Act:
+		context.extractor().extract(transactionInfoSet);
+
+		// Assert:
+		EXPECT_EQ(50u, context.publisher().numPublishCalls());
+
+		// - all have addresses and the previously existing addresses are unchanged
+		for (auto i = 0u; i < transactionInfos.size(); ++i) {
+			const auto& pExtractedAddresses = transactionInfoSet.find(transactionInfos[i])->OptionalExtractedAddresses;
+			EXPECT_TRUE(!!pExtractedAddresses) << "info at " << i;
+
+			if (0 == i % 2)
+				EXPECT_EQ(pAddresses, pExtractedAddresses) << "info at " << i;
+			else
+				EXPECT_NE(pAddresses, pExtractedAddresses) << "info at " << i;
+		}
+	}
+
 	// endregion
 
 	// region extract (TransactionElement)
@@ -321,5 +360,37 @@ namespace catapult { namespace addressextraction {
 				*blockElement.Transactions[3].OptionalExtractedAddresses);
 	}
 
+	TEST(TEST_CLASS, ExtractAddsTransactionResolvedAddressesWhenBlockStatementIsPresent_BlockElement_Parallel) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool(4);
+		TestContext context(*pPool);
+
+		// - create 50 transaction elements and associate two addresses with each transaction
+		constexpr auto Num_Transactions = 50u;
+		model::Block block;
+		model::BlockElement blockElement(block);
+		auto seedAddresses = SeedTransactionsWithExtractedAddresses(blockElement, Num_Transactions);
+
+		// - resolve the first address of each transaction to a transaction specific address
+		auto seedResolvedAddresses = test::GenerateRandomDataVector<Address>(Num_Transactions);
+		auto pBlockStatement = std::make_shared<model::BlockStatement>();
+		for (auto i = 0u; i < Num_Transactions; ++i)
+			AddAddressResolutionStatement(*pBlockStatement, seedAddresses[2 * i], { { { i + 1, 0 }, seedResolvedAddresses[i] } });
+
+		blockElement.OptionalStatement = std::move(pBlockStatement);
+
+		// Act:
+		context.extractor().extract(blockElement);
+
+		// Assert:
+		EXPECT_EQ(0u, context.publisher().numPublishCalls());
+
+		// - all have all expected addresses
+		for (auto i = 0u; i < Num_Transactions; ++i) {
+			auto expectedAddresses = ToAddressSet(seedAddresses, { 2 * i, 2 * i + 1 }, seedResolvedAddresses, { i });
+			EXPECT_EQ(expectedAddresses, *blockElement.Transactions[i].OptionalExtractedAddresses) << "transaction at " << i;
+		}
+	}
+
 	// endregion
 }}
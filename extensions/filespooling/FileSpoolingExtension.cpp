@@ -26,24 +26,94 @@
 #include "src/FileUtChangeStorage.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
+#include "catapult/extensions/ServiceRegistrar.h"
+#include "catapult/extensions/ServiceState.h"
 #include "catapult/io/FileQueue.h"
+#include "catapult/thread/MultiServicePool.h"
+#include "catapult/thread/Scheduler.h"
 
 namespace catapult { namespace filespooling {
 
 	namespace {
+		// spooled messages are small, so group them into shared segment files to avoid creating a file per message
+		constexpr uint64_t Max_Spool_Segment_Size = 16 * 1024 * 1024;
+
+		// transient queues are purged by recovery, so their messages can be made visible to the broker in groups
+		constexpr uint64_t Max_Transient_Pending_Size = 1024 * 1024;
+		constexpr auto Max_Transient_Pending_Duration = utils::TimeSpan::FromMilliseconds(250);
+		constexpr auto Commit_Task_Delay = utils::TimeSpan::FromMilliseconds(100);
+
+		using FileQueueWriters = std::vector<io::FileQueueWriter*>;
+
 		class FileQueueFactory {
 		public:
 			explicit FileQueueFactory(const std::string& dataDirectory)
 					: m_dataDirectory(config::CatapultDataDirectoryPreparer::Prepare(dataDirectory))
+					, m_pGroupCommitWriters(std::make_shared<FileQueueWriters>())
 			{}
 
+		public:
+			const std::shared_ptr<FileQueueWriters>& groupCommitWriters() const {
+				return m_pGroupCommitWriters;
+			}
+
 		public:
 			std::unique_ptr<io::FileQueueWriter> create(const std::string& queueName) const {
-				return std::make_unique<io::FileQueueWriter>(m_dataDirectory.spoolDir(queueName).str());
+				return create(queueName, { Max_Spool_Segment_Size, 0, utils::TimeSpan() });
+			}
+
+			std::unique_ptr<io::FileQueueWriter> createGroupCommit(const std::string& queueName) {
+				auto pWriter = create(queueName, { Max_Spool_Segment_Size, Max_Transient_Pending_Size, Max_Transient_Pending_Duration });
+				m_pGroupCommitWriters->push_back(pWriter.get());
+				return pWriter;
+			}
+
+		private:
+			std::unique_ptr<io::FileQueueWriter> create(
+					const std::string& queueName,
+					const io::FileQueueSegmentOptions& segmentOptions) const {
+				auto directory = m_dataDirectory.spoolDir(queueName).str();
+				return std::make_unique<io::FileQueueWriter>(directory, "index.dat", segmentOptions);
 			}
 
 		private:
 			config::CatapultDataDirectory m_dataDirectory;
+			std::shared_ptr<FileQueueWriters> m_pGroupCommitWriters;
+		};
+
+		class FileSpoolingCommitServiceRegistrar : public extensions::ServiceRegistrar {
+		public:
+			explicit FileSpoolingCommitServiceRegistrar(const std::shared_ptr<FileQueueWriters>& pWriters) : m_pWriters(pWriters)
+			{}
+
+		public:
+			extensions::ServiceRegistrarInfo info() const override {
+				return { "FileSpoolingCommit", extensions::ServiceRegistrarPhase::Initial };
+			}
+
+			void registerServiceCounters(extensions::ServiceLocator&) override {
+				// no additional counters
+			}
+
+			void registerServices(extensions::ServiceLocator&, extensions::ServiceState& state) override {
+				// writers only check pending duration when flushed, so messages in idle queues need to be committed periodically
+				thread::Task task;
+				task.StartDelay = Commit_Task_Delay;
+				task.NextDelay = thread::CreateUniformDelayGenerator(Commit_Task_Delay);
+				task.Name = "file spooling commit task";
+				task.Callback = [pWriters = m_pWriters]() {
+					for (auto* pWriter : *pWriters)
+						pWriter->commitExpired();
+
+					return thread::make_ready_future(thread::TaskResult::Continue);
+				};
+
+				auto pScheduler = state.pool().pushServiceGroup("filespooling")->pushService(thread::CreateScheduler);
+				pScheduler->addTask(task);
+			}
+
+		private:
+			std::shared_ptr<FileQueueWriters> m_pWriters;
 		};
 
 		void RegisterExtension(extensions::ProcessBootstrapper& bootstrapper) {
@@ -51,10 +121,15 @@ namespace catapult { namespace filespooling {
 			FileQueueFactory factory(bootstrapper.config().User.DataDirectory);
 			auto& subscriptionManager = bootstrapper.subscriptionManager();
 			subscriptionManager.addBlockChangeSubscriber(CreateFileBlockChangeStorage(factory.create("block_change")));
-			subscriptionManager.addUtChangeSubscriber(CreateFileUtChangeStorage(factory.create("unconfirmed_transactions_change")));
-			subscriptionManager.addPtChangeSubscriber(CreateFilePtChangeStorage(factory.create("partial_transactions_change")));
+			auto pUtChangeWriter = factory.createGroupCommit("unconfirmed_transactions_change");
+			subscriptionManager.addUtChangeSubscriber(CreateFileUtChangeStorage(std::move(pUtChangeWriter)));
+			subscriptionManager.addPtChangeSubscriber(CreateFilePtChangeStorage(factory.createGroupCommit("partial_transactions_change")));
 			subscriptionManager.addFinalizationSubscriber(CreateFileFinalizationStorage(factory.create("finalization")));
 			subscriptionManager.addTransactionStatusSubscriber(CreateFileTransactionStatusStorage(factory.create("transaction_status")));
+
+			// register service
+			auto pServiceRegistrar = std::make_unique<FileSpoolingCommitServiceRegistrar>(factory.groupCommitWriters());
+			bootstrapper.extensionManager().addServiceRegistrar(std::move(pServiceRegistrar));
 		}
 	}
 }}
@@ -53,6 +53,10 @@ namespace catapult { namespace filespooling {
 				m_pOutputStream->flush();
 			}
 
+			void flush() override {
+				// empty because output stream is flushed in notifyBlock and notifyDropBlocksAfter
+			}
+
 		private:
 			std::unique_ptr<io::OutputStream> m_pOutputStream;
 		};
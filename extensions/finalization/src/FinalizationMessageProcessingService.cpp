@@ -26,10 +26,12 @@
 #include "finalization/src/ionet/FinalizationMessagePacketUtils.h"
 #include "finalization/src/model/FinalizationRoundRange.h"
 #include "catapult/consumers/RecentHashCache.h"
+#include "catapult/crypto/SecureRandomGenerator.h"
 #include "catapult/extensions/DispatcherUtils.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/extensions/ServiceUtils.h"
 #include "catapult/thread/MultiServicePool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/ThrottleLogger.h"
 
 namespace catapult { namespace finalization {
@@ -39,6 +41,9 @@ namespace catapult { namespace finalization {
 
 		constexpr auto Writers_Service_Name = "fin.writers";
 
+		// minimum number of messages verified by a single partition
+		constexpr size_t Min_Messages_Per_Partition = 16;
+
 		auto CreateNewMessagesSink(const extensions::ServiceLocator& locator) {
 			return extensions::CreatePushEntitySink<MessagesSink>(locator, Writers_Service_Name);
 		}
@@ -48,6 +53,37 @@ namespace catapult { namespace finalization {
 			return model::FinalizationRoundRange(view.minFinalizationRound(), view.maxFinalizationRound());
 		}
 
+		crypto::RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				crypto::SecureRandomGenerator().fill(pOut, count);
+			};
+		}
+
+		std::vector<bool> VerifyMessageSignatures(
+				thread::IoThreadPool& pool,
+				const std::vector<std::shared_ptr<model::FinalizationMessage>>& messages) {
+			auto numPartitions = (messages.size() + Min_Messages_Per_Partition - 1) / Min_Messages_Per_Partition;
+			numPartitions = std::min<size_t>(pool.numWorkerThreads(), numPartitions);
+
+			// std::vector<bool> cannot be written concurrently, so collect results per partition
+			std::vector<std::vector<bool>> partitionResults(numPartitions);
+			thread::ParallelForPartition(pool.ioContext(), messages, numPartitions, [&partitionResults](
+					auto itBegin,
+					auto itEnd,
+					auto,
+					auto batchIndex) {
+				auto count = static_cast<size_t>(std::distance(itBegin, itEnd));
+				partitionResults[batchIndex] = model::VerifyMessageSignatures(CreateRandomFiller(), &*itBegin, count);
+			}).get();
+
+			std::vector<bool> results;
+			results.reserve(messages.size());
+			for (const auto& partitionResult : partitionResults)
+				results.insert(results.end(), partitionResult.cbegin(), partitionResult.cend());
+
+			return results;
+		}
+
 		class FinalizationMessageProcessingServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			explicit FinalizationMessageProcessingServiceRegistrar(const FinalizationConfiguration& config) : m_config(config)
@@ -80,6 +116,7 @@ namespace catapult { namespace finalization {
 					CATAPULT_LOG(trace) << "received " << extractedMessages.size() << " messages from peer " << messages.SourceIdentity;
 
 					auto roundRange = CreateFinalizationRoundRange(messageAggregator);
+					auto candidateMessages = std::vector<std::shared_ptr<model::FinalizationMessage>>();
 					for (const auto& pMessage : extractedMessages) {
 						// ignore messages associated with an out of range finalization round
 						auto messageRound = pMessage->StepIdentifier.Round();
@@ -90,14 +127,31 @@ namespace catapult { namespace finalization {
 							continue;
 						}
 
-						auto messageHash = model::CalculateMessageHash(*pMessage);
-						if (!pRecentHashCache->add(messageHash))
+						// deduplicate before verification so that each unique message is only verified once
+						if (!pRecentHashCache->add(model::CalculateMessageHash(*pMessage)))
 							continue;
 
-						messageProcessingPool.ioContext().dispatch([&messageAggregator, pMessage, messageHash]() {
-							auto addResult = messageAggregator.modifier().add(pMessage);
-							if (addResult < chain::RoundMessageAggregatorAddResult::Neutral_Redundant)
-								CATAPULT_LOG(warning) << "finalization message " << messageHash << " rejected due to " << addResult;
+						candidateMessages.push_back(pMessage);
+					}
+
+					if (candidateMessages.empty())
+						return;
+
+					auto verificationResults = VerifyMessageSignatures(messageProcessingPool, candidateMessages);
+					for (auto i = 0u; i < candidateMessages.size(); ++i) {
+						const auto& pMessage = candidateMessages[i];
+						if (!verificationResults[i]) {
+							CATAPULT_LOG(warning) << "finalization message from " << messages.SourceIdentity << " has invalid signature";
+							continue;
+						}
+
+						messageProcessingPool.ioContext().dispatch([&messageAggregator, pMessage]() {
+							auto addResult = messageAggregator.modifier().addWithVerifiedSignature(pMessage);
+							if (addResult < chain::RoundMessageAggregatorAddResult::Neutral_Redundant) {
+								CATAPULT_LOG(warning)
+										<< "finalization message " << model::CalculateMessageHash(*pMessage)
+										<< " rejected due to " << addResult;
+							}
 						});
 						newMessages.push_back(pMessage);
 					}
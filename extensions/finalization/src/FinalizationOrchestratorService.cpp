@@ -40,6 +40,9 @@ namespace catapult { namespace finalization {
 	namespace {
 		constexpr auto Orchestrator_Service_Name = "fin.orchestrator";
 
+		// number of voting private key trees loaded ahead of use so that epoch transitions do not block on disk
+		constexpr size_t Num_Prefetched_Voting_Private_Key_Trees = 2;
+
 		// region BootstrapperFacade
 
 		void SaveMessageToDisk(const config::CatapultDirectory& dataDirectory, const model::FinalizationMessage& message) {
@@ -168,7 +171,7 @@ namespace catapult { namespace finalization {
 
 			static crypto::AggregateBmPrivateKeyTree CreateVotingPrivateKeyTree(const config::UserConfiguration& userConfig) {
 				auto factory = CreateBmPrivateKeyTreeFactory(config::CatapultDirectory(userConfig.VotingKeysDirectory));
-				return crypto::AggregateBmPrivateKeyTree(factory);
+				return crypto::AggregateBmPrivateKeyTree(factory, Num_Prefetched_Voting_Private_Key_Trees);
 			}
 
 			static std::string GetVotingPrivateKeyTreeFilename(uint64_t treeSequenceId) {
@@ -180,20 +183,19 @@ namespace catapult { namespace finalization {
 			static supplier<std::unique_ptr<crypto::BmPrivateKeyTree>> CreateBmPrivateKeyTreeFactory(
 					const config::CatapultDirectory& directory) {
 				auto treeSequenceId = 1u;
-				std::shared_ptr<io::FileStream> pKeyTreeStream;
-				return [treeSequenceId, pKeyTreeStream, directory]() mutable {
-					auto keyTreeFilename = directory.file(GetVotingPrivateKeyTreeFilename(treeSequenceId++));
+				return [treeSequenceId, directory]() mutable {
+					auto keyTreeFilename = directory.file(GetVotingPrivateKeyTreeFilename(treeSequenceId));
 					CATAPULT_LOG(debug) << "loading voting private key tree from " << keyTreeFilename;
 
+					// only advance the sequence after a successful load so that a missing tree can be loaded when it is added later
 					if (!std::filesystem::exists(keyTreeFilename)) {
-						CATAPULT_LOG(error) << "could not load voting private key tree from " << keyTreeFilename;
+						CATAPULT_LOG(warning) << "could not load voting private key tree from " << keyTreeFilename;
 						return std::unique_ptr<crypto::BmPrivateKeyTree>();
 					}
 
 					auto keyTreeFile = io::RawFile(keyTreeFilename, io::OpenMode::Read_Append);
-					pKeyTreeStream = std::make_shared<io::FileStream>(std::move(keyTreeFile));
-
-					auto tree = crypto::BmPrivateKeyTree::FromStream(*pKeyTreeStream);
+					auto tree = crypto::BmPrivateKeyTree::FromStream(std::make_unique<io::FileStream>(std::move(keyTreeFile)));
+					++treeSequenceId;
 					return std::make_unique<crypto::BmPrivateKeyTree>(std::move(tree));
 				};
 			}
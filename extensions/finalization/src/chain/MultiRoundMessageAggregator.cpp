@@ -161,13 +161,27 @@ namespace catapult { namespace chain {
 	}
 
 	RoundMessageAggregatorAddResult MultiRoundMessageAggregatorModifier::add(const std::shared_ptr<model::FinalizationMessage>& pMessage) {
-		auto messageRound = pMessage->StepIdentifier.Round();
+		auto* pRoundAggregator = findOrCreateRoundMessageAggregator(*pMessage);
+		return pRoundAggregator ? pRoundAggregator->add(pMessage) : RoundMessageAggregatorAddResult::Failure_Invalid_Point;
+	}
+
+	RoundMessageAggregatorAddResult MultiRoundMessageAggregatorModifier::addWithVerifiedSignature(
+			const std::shared_ptr<model::FinalizationMessage>& pMessage) {
+		auto* pRoundAggregator = findOrCreateRoundMessageAggregator(*pMessage);
+		return pRoundAggregator
+				? pRoundAggregator->addWithVerifiedSignature(pMessage)
+				: RoundMessageAggregatorAddResult::Failure_Invalid_Point;
+	}
+
+	RoundMessageAggregator* MultiRoundMessageAggregatorModifier::findOrCreateRoundMessageAggregator(
+			const model::FinalizationMessage& message) {
+		auto messageRound = message.StepIdentifier.Round();
 		if (m_state.MinFinalizationRound > messageRound || m_state.MaxFinalizationRound < messageRound) {
 			CATAPULT_LOG(warning)
 					<< "rejecting message with round " << messageRound
 					<< ", min round " << m_state.MinFinalizationRound
 					<< ", max round " << m_state.MaxFinalizationRound;
-			return RoundMessageAggregatorAddResult::Failure_Invalid_Point;
+			return nullptr;
 		}
 
 		auto iter = m_state.RoundMessageAggregators.find(messageRound);
@@ -176,7 +190,7 @@ namespace catapult { namespace chain {
 			iter = m_state.RoundMessageAggregators.emplace(messageRound, std::move(pRoundAggregator)).first;
 		}
 
-		return iter->second->add(pMessage);
+		return iter->second.get();
 	}
 
 	void MultiRoundMessageAggregatorModifier::prune(FinalizationEpoch epoch) {
@@ -26,6 +26,23 @@ namespace catapult { namespace chain {
 
 	namespace {
 		constexpr auto Try_Find_Failure_Result = std::make_pair(model::HeightHashPair(), false);
+
+		template<typename TCandidate>
+		TCandidate* TryFindAncestor(TCandidate& candidate, uint64_t distance) {
+			// each ancestor is exactly one height below its child, so ancestors can be found by combining power of two jumps
+			auto* pCandidate = &candidate;
+			for (auto i = 0u; 0 != distance; ++i, distance >>= 1) {
+				if (0 == (distance & 1))
+					continue;
+
+				if (i >= pCandidate->Ancestors.size())
+					return nullptr;
+
+				pCandidate = pCandidate->Ancestors[i];
+			}
+
+			return pCandidate;
+		}
 	}
 
 	bool RoundContext::HeightHashPairComparer::operator()(const model::HeightHashPair& lhs, const model::HeightHashPair& rhs) const {
@@ -40,6 +57,8 @@ namespace catapult { namespace chain {
 			: m_totalWeight(weight)
 			, m_threshold(threshold)
 			, m_cumulativePrecommitWeight(0)
+			, m_pBestPrevote(nullptr)
+			, m_pBestPrecommit(nullptr)
 	{}
 
 	size_t RoundContext::size() const {
@@ -47,39 +66,39 @@ namespace catapult { namespace chain {
 	}
 
 	std::pair<model::HeightHashPair, bool> RoundContext::tryFindBestPrevote() const {
-		return tryFindLastMatch([threshold = m_threshold](const auto&, const auto& weights) {
-			return weights.Prevote >= threshold;
-		});
+		return m_pBestPrevote ? std::make_pair(m_pBestPrevote->Key, true) : Try_Find_Failure_Result;
 	}
 
 	std::pair<model::HeightHashPair, bool> RoundContext::tryFindBestPrecommit() const {
-		return tryFindLastMatch([threshold = m_threshold](const auto&, const auto& weights) {
-			return weights.Prevote >= threshold && weights.Precommit >= threshold;
-		});
+		return m_pBestPrecommit ? std::make_pair(m_pBestPrecommit->Key, true) : Try_Find_Failure_Result;
 	}
 
 	std::pair<model::HeightHashPair, bool> RoundContext::tryFindEstimate() const {
-		auto bestPrevoteResultPair = tryFindBestPrevote();
-		if (!bestPrevoteResultPair.second)
+		if (!m_pBestPrevote)
 			return Try_Find_Failure_Result;
 
-		return tryFindEstimate(bestPrevoteResultPair.first);
+		return tryFindEstimate(*m_pBestPrevote);
 	}
 
 	bool RoundContext::isDescendant(const model::HeightHashPair& parentKey, const model::HeightHashPair& childKey) const {
-		return m_tree.isDescendant(parentKey, childKey);
+		const auto* pChild = tryFindCandidate(childKey);
+		if (!pChild || parentKey.Height > childKey.Height)
+			return false;
+
+		const auto* pParent = TryFindAncestor(*pChild, (childKey.Height - parentKey.Height).unwrap());
+		return pParent && parentKey == pParent->Key;
 	}
 
 	bool RoundContext::isCompletable() const {
-		auto bestPrevoteResultPair = tryFindBestPrevote();
-		if (!bestPrevoteResultPair.second) {
+		if (!m_pBestPrevote) {
 			CATAPULT_LOG(trace) << "not completable - no best prevote";
 			return false;
 		}
 
 		// Erv < g(Vrv) is always completable
-		auto estimateResultPair = tryFindEstimate(bestPrevoteResultPair.first);
-		if (estimateResultPair.second && bestPrevoteResultPair.first != estimateResultPair.first) {
+		const auto& bestPrevote = *m_pBestPrevote;
+		auto estimateResultPair = tryFindEstimate(bestPrevote);
+		if (estimateResultPair.second && bestPrevote.Key != estimateResultPair.first) {
 			CATAPULT_LOG(trace) << "completable - Erv < g(Vrv)";
 			return true;
 		}
@@ -92,17 +111,15 @@ namespace catapult { namespace chain {
 			return false;
 		}
 
-		for (auto iter = m_candidates.crbegin(); m_candidates.crend() != iter; ++iter) {
-			// check explicitly because isDescendant includes self
-			if (bestPrevoteResultPair.first == iter->first)
-				continue;
-
+		// precommit weight of a candidate is never smaller than the precommit weight of any of its descendants,
+		// so only direct `best prevote` descendants need to be checked
+		for (const auto* pChild : bestPrevote.Children) {
 			// if any `best prevote` descendant can reach precommit threshold, round is not yet completable
-			if (m_tree.isDescendant(bestPrevoteResultPair.first, iter->first) && canReachPrecommitThreshold(iter->second)) {
+			if (canReachPrecommitThreshold(pChild->Weights)) {
 				CATAPULT_LOG(debug)
 						<< "not completable - Erv == g(Vrv) and descendant can reach g(Crv)"
 						<< " (total weight " << m_totalWeight << ", cumulative precommit weight " << m_cumulativePrecommitWeight
-						<< ", prevote weight " << iter->second.Prevote << ", precommit weight " << iter->second.Precommit << ")";
+						<< ", prevote weight " << pChild->Weights.Prevote << ", precommit weight " << pChild->Weights.Precommit << ")";
 				return false;
 			}
 		}
@@ -112,60 +129,136 @@ namespace catapult { namespace chain {
 	}
 
 	RoundContext::Weights RoundContext::weights(const model::HeightHashPair& key) const {
-		auto iter = m_candidates.find(key);
-		return m_candidates.cend() == iter ? RoundContext::Weights() : iter->second;
+		const auto* pCandidate = tryFindCandidate(key);
+		return pCandidate ? pCandidate->Weights : RoundContext::Weights();
 	}
 
 	bool RoundContext::canReachPrecommitThreshold(const Weights& weights) const {
 		return weights.Precommit + (m_totalWeight - m_cumulativePrecommitWeight) >= m_threshold;
 	}
 
-	std::pair<model::HeightHashPair, bool> RoundContext::tryFindLastMatch(const MatchPredicate& predicate) const {
-		auto iter = std::find_if(m_candidates.crbegin(), m_candidates.crend(), [predicate](const auto& pair) {
-			return predicate(pair.first, pair.second);
-		});
+	std::pair<model::HeightHashPair, bool> RoundContext::tryFindEstimate(const Candidate& bestPrevote) const {
+		if (canReachPrecommitThreshold(bestPrevote.Weights))
+			return std::make_pair(bestPrevote.Key, true);
+
+		// precommit weights never decrease toward the root, so find the last ancestor that cannot reach precommit threshold
+		const auto* pCandidate = &bestPrevote;
+		for (auto i = bestPrevote.Ancestors.size(); i > 0; --i) {
+			if (i - 1 < pCandidate->Ancestors.size() && !canReachPrecommitThreshold(pCandidate->Ancestors[i - 1]->Weights))
+				pCandidate = pCandidate->Ancestors[i - 1];
+		}
 
-		return m_candidates.crend() == iter ? Try_Find_Failure_Result : std::make_pair(iter->first, true);
+		// its parent (if any) is the estimate
+		return pCandidate->Ancestors.empty() ? Try_Find_Failure_Result : std::make_pair(pCandidate->Ancestors[0]->Key, true);
 	}
 
-	std::pair<model::HeightHashPair, bool> RoundContext::tryFindEstimate(const model::HeightHashPair& bestPrevote) const {
-		return tryFindLastMatch([this, &bestPrevote](const auto& key, const auto& weights) {
-			return m_tree.isDescendant(key, bestPrevote) && canReachPrecommitThreshold(weights);
-		});
+	RoundContext::Candidate* RoundContext::tryFindCandidate(const model::HeightHashPair& key) const {
+		if (m_heightIndex.empty() || key.Height < m_minHeight || (key.Height - m_minHeight).unwrap() >= m_heightIndex.size())
+			return nullptr;
+
+		for (auto* pCandidate : m_heightIndex[(key.Height - m_minHeight).unwrap()]) {
+			if (key.Hash == pCandidate->Key.Hash)
+				return pCandidate;
+		}
+
+		return nullptr;
 	}
 
-	void RoundContext::acceptPrevote(Height height, const Hash256* pHashes, size_t count, uint64_t weight) {
-		m_tree.addBranch(height, pHashes, count);
+	RoundContext::Candidate& RoundContext::findOrInsertCandidate(const model::HeightHashPair& key, Candidate* pParent) {
+		// heights of prevoted hashes are bounded by the voting set epoch, so the height index stays dense
+		if (m_heightIndex.empty()) {
+			m_minHeight = key.Height;
+		} else if (key.Height < m_minHeight) {
+			m_heightIndex.insert(m_heightIndex.begin(), (m_minHeight - key.Height).unwrap(), std::vector<Candidate*>());
+			m_minHeight = key.Height;
+		}
+
+		auto index = (key.Height - m_minHeight).unwrap();
+		if (index >= m_heightIndex.size())
+			m_heightIndex.resize(index + 1);
+
+		auto& bucket = m_heightIndex[index];
+		for (auto* pCandidate : bucket) {
+			if (key.Hash == pCandidate->Key.Hash)
+				return *pCandidate;
+		}
+
+		// parent of an existing candidate is never changed
+		m_candidates.emplace_back(key);
+		auto& candidate = m_candidates.back();
+		bucket.push_back(&candidate);
 
+		if (pParent) {
+			pParent->Children.push_back(&candidate);
+
+			candidate.Ancestors.push_back(pParent);
+			while (candidate.Ancestors.back()->Ancestors.size() >= candidate.Ancestors.size()) {
+				const auto& nextAncestors = candidate.Ancestors.back()->Ancestors;
+				candidate.Ancestors.push_back(nextAncestors[candidate.Ancestors.size() - 1]);
+			}
+		}
+
+		return candidate;
+	}
+
+	void RoundContext::addPrecommitWeight(Candidate& candidate, uint64_t weight) {
+		auto* pCandidate = &candidate;
+		while (true) {
+			pCandidate->Weights.Precommit += weight;
+			updateBestCandidates(*pCandidate);
+
+			if (pCandidate->Ancestors.empty())
+				break;
+
+			pCandidate = pCandidate->Ancestors[0];
+		}
+	}
+
+	void RoundContext::updateBestCandidates(const Candidate& candidate) {
+		if (candidate.Weights.Prevote < m_threshold)
+			return;
+
+		// weights never decrease, so a candidate that reaches a threshold keeps satisfying it
+		HeightHashPairComparer comparer;
+		if (!m_pBestPrevote || comparer(m_pBestPrevote->Key, candidate.Key))
+			m_pBestPrevote = &candidate;
+
+		if (candidate.Weights.Precommit >= m_threshold && (!m_pBestPrecommit || comparer(m_pBestPrecommit->Key, candidate.Key)))
+			m_pBestPrecommit = &candidate;
+	}
+
+	void RoundContext::acceptPrevote(Height height, const Hash256* pHashes, size_t count, uint64_t weight) {
+		Candidate* pParent = nullptr;
 		for (auto i = 0u; i < count; ++i) {
 			auto key = model::HeightHashPair{ height + Height(i), pHashes[i] };
-			auto insertResultPair = m_candidates.emplace(key, Weights());
-			insertResultPair.first->second.Prevote += weight;
+			auto& candidate = findOrInsertCandidate(key, pParent);
+			candidate.Weights.Prevote += weight;
+			updateBestCandidates(candidate);
 
 			// check and update if hash has pending precommit
-			auto pendingPrecommitWeightsIter = m_pendingPrecommitWeights.find(key);
-			if (m_pendingPrecommitWeights.cend() != pendingPrecommitWeightsIter) {
-				auto ancestorKeys = m_tree.findAncestors(key);
-				for (const auto& ancestorKey : ancestorKeys)
-					m_candidates.find(ancestorKey)->second.Precommit += pendingPrecommitWeightsIter->second;
-
-				m_cumulativePrecommitWeight += pendingPrecommitWeightsIter->second;
-				m_pendingPrecommitWeights.erase(pendingPrecommitWeightsIter);
+			if (!m_pendingPrecommitWeights.empty()) {
+				auto pendingPrecommitWeightsIter = m_pendingPrecommitWeights.find(key);
+				if (m_pendingPrecommitWeights.cend() != pendingPrecommitWeightsIter) {
+					addPrecommitWeight(candidate, pendingPrecommitWeightsIter->second);
+
+					m_cumulativePrecommitWeight += pendingPrecommitWeightsIter->second;
+					m_pendingPrecommitWeights.erase(pendingPrecommitWeightsIter);
+				}
 			}
+
+			pParent = &candidate;
 		}
 	}
 
 	void RoundContext::acceptPrecommit(Height height, const Hash256& hash, uint64_t weight) {
 		auto key = model::HeightHashPair{ height, hash };
-		auto ancestorKeys = m_tree.findAncestors(key);
-		if (ancestorKeys.empty()) {
+		auto* pCandidate = tryFindCandidate(key);
+		if (!pCandidate) {
 			m_pendingPrecommitWeights.emplace(key, 0).first->second += weight;
 			return;
 		}
 
-		for (const auto& ancestorKey : ancestorKeys)
-			m_candidates.find(ancestorKey)->second.Precommit += weight;
-
+		addPrecommitWeight(*pCandidate, weight);
 		m_cumulativePrecommitWeight += weight;
 	}
 }}
@@ -20,14 +20,16 @@
 **/
 
 #pragma once
-#include "FinalizationHashTree.h"
-#include "catapult/functions.h"
-#include <map>
+#include "catapult/model/HeightHashPair.h"
+#include <deque>
 #include <unordered_map>
+#include <vector>
 
 namespace catapult { namespace chain {
 
 	/// Context for a finalization round.
+	/// \note Candidates are stored in a tree indexed by height so that lookups, best vote queries and descendant checks
+	///       do not need to scan all candidates.
 	class RoundContext {
 	public:
 		/// Weights associated with a finalization candidate.
@@ -66,13 +68,34 @@ namespace catapult { namespace chain {
 		Weights weights(const model::HeightHashPair& key) const;
 
 	private:
-		using MatchPredicate = predicate<const model::HeightHashPair&, const Weights&>;
+		struct Candidate {
+		public:
+			explicit Candidate(const model::HeightHashPair& key) : Key(key)
+			{}
 
+		public:
+			model::HeightHashPair Key;
+			RoundContext::Weights Weights;
+
+			/// Ancestors at power of two distances (first element is the parent).
+			std::vector<Candidate*> Ancestors;
+
+			/// Direct descendants.
+			std::vector<const Candidate*> Children;
+		};
+
+	private:
 		bool canReachPrecommitThreshold(const Weights& weights) const;
 
-		std::pair<model::HeightHashPair, bool> tryFindLastMatch(const MatchPredicate& predicate) const;
+		std::pair<model::HeightHashPair, bool> tryFindEstimate(const Candidate& bestPrevote) const;
 
-		std::pair<model::HeightHashPair, bool> tryFindEstimate(const model::HeightHashPair& bestPrevote) const;
+		Candidate* tryFindCandidate(const model::HeightHashPair& key) const;
+
+		Candidate& findOrInsertCandidate(const model::HeightHashPair& key, Candidate* pParent);
+
+		void addPrecommitWeight(Candidate& candidate, uint64_t weight);
+
+		void updateBestCandidates(const Candidate& candidate);
 
 	public:
 		/// Accepts a prevote for \a count hashes (\a pHashes) starting at \a height with \a weight.
@@ -95,8 +118,12 @@ namespace catapult { namespace chain {
 		const uint64_t m_threshold;
 		uint64_t m_cumulativePrecommitWeight;
 
-		FinalizationHashTree m_tree;
-		std::map<model::HeightHashPair, Weights, HeightHashPairComparer> m_candidates;
+		std::deque<Candidate> m_candidates;
+		Height m_minHeight;
+		std::deque<std::vector<Candidate*>> m_heightIndex;
+		const Candidate* m_pBestPrevote;
+		const Candidate* m_pBestPrecommit;
+
 		std::unordered_map<model::HeightHashPair, uint64_t, HeightHashPairHasher> m_pendingPrecommitWeights;
 	};
 }}
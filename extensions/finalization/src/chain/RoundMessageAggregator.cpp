@@ -123,6 +123,22 @@ namespace catapult { namespace chain {
 
 		public:
 			RoundMessageAggregatorAddResult add(const std::shared_ptr<model::FinalizationMessage>& pMessage) override {
+				return add(pMessage, model::ProcessMessage);
+			}
+
+			RoundMessageAggregatorAddResult addWithVerifiedSignature(
+					const std::shared_ptr<model::FinalizationMessage>& pMessage) override {
+				return add(pMessage, model::ProcessMessageWithVerifiedSignature);
+			}
+
+		private:
+			using MessageProcessor = std::pair<model::ProcessMessageResult, size_t> (*)(
+					const model::FinalizationMessage&,
+					const model::FinalizationContext&);
+
+			RoundMessageAggregatorAddResult add(
+					const std::shared_ptr<model::FinalizationMessage>& pMessage,
+					MessageProcessor processMessage) {
 				auto maxHashesPerPoint = m_finalizationContext.config().MaxHashesPerPoint;
 				CATAPULT_LOG(trace)
 						<< "received message at " << pMessage->StepIdentifier
@@ -159,7 +175,7 @@ namespace catapult { namespace chain {
 							: RoundMessageAggregatorAddResult::Failure_Conflicting;
 				}
 
-				auto processResultPair = model::ProcessMessage(*pMessage, m_finalizationContext);
+				auto processResultPair = processMessage(*pMessage, m_finalizationContext);
 				if (model::ProcessMessageResult::Success != processResultPair.first) {
 					CATAPULT_LOG(warning) << "rejecting finalization message with result " << processResultPair.first;
 					return RoundMessageAggregatorAddResult::Failure_Processing;
@@ -92,21 +92,50 @@ namespace catapult { namespace model {
 		return pMessage;
 	}
 
-	std::pair<ProcessMessageResult, size_t> ProcessMessage(const FinalizationMessage& message, const FinalizationContext& context) {
-		auto accountView = context.lookup(message.Signature.Root.ParentPublicKey);
-		if (Amount() == accountView.Weight)
-			return std::make_pair(ProcessMessageResult::Failure_Voter, 0);
+	namespace {
+		std::pair<ProcessMessageResult, size_t> ProcessMessage(
+				const FinalizationMessage& message,
+				const FinalizationContext& context,
+				bool shouldVerifySignature) {
+			auto accountView = context.lookup(message.Signature.Root.ParentPublicKey);
+			if (Amount() == accountView.Weight)
+				return std::make_pair(ProcessMessageResult::Failure_Voter, 0);
+
+			if (0 != message.FinalizationMessage_Reserved1)
+				return std::make_pair(ProcessMessageResult::Failure_Padding, 0);
+
+			if (FinalizationMessage::Current_Version != message.Version)
+				return std::make_pair(ProcessMessageResult::Failure_Version, 0);
+
+			auto keyIdentifier = StepIdentifierToBmKeyIdentifier(message.StepIdentifier);
+			if (shouldVerifySignature && !crypto::Verify(message.Signature, keyIdentifier, ToBuffer(message)))
+				return std::make_pair(ProcessMessageResult::Failure_Signature, 0);
+
+			return std::make_pair(ProcessMessageResult::Success, accountView.Weight.unwrap());
+		}
+	}
 
-		if (0 != message.FinalizationMessage_Reserved1)
-			return std::make_pair(ProcessMessageResult::Failure_Padding, 0);
+	std::pair<ProcessMessageResult, size_t> ProcessMessage(const FinalizationMessage& message, const FinalizationContext& context) {
+		return ProcessMessage(message, context, true);
+	}
 
-		if (FinalizationMessage::Current_Version != message.Version)
-			return std::make_pair(ProcessMessageResult::Failure_Version, 0);
+	std::pair<ProcessMessageResult, size_t> ProcessMessageWithVerifiedSignature(
+			const FinalizationMessage& message,
+			const FinalizationContext& context) {
+		return ProcessMessage(message, context, false);
+	}
 
-		auto keyIdentifier = StepIdentifierToBmKeyIdentifier(message.StepIdentifier);
-		if (!crypto::Verify(message.Signature, keyIdentifier, ToBuffer(message)))
-			return std::make_pair(ProcessMessageResult::Failure_Signature, 0);
+	std::vector<bool> VerifyMessageSignatures(
+			const crypto::RandomFiller& randomFiller,
+			const std::shared_ptr<FinalizationMessage>* pMessages,
+			size_t count) {
+		std::vector<crypto::BmTreeSignatureInput> signatureInputs;
+		signatureInputs.reserve(count);
+		for (auto i = 0u; i < count; ++i) {
+			const auto& message = *pMessages[i];
+			signatureInputs.push_back({ message.Signature, StepIdentifierToBmKeyIdentifier(message.StepIdentifier), ToBuffer(message) });
+		}
 
-		return std::make_pair(ProcessMessageResult::Success, accountView.Weight.unwrap());
+		return crypto::VerifyMulti(randomFiller, signatureInputs.data(), signatureInputs.size());
 	}
 }}
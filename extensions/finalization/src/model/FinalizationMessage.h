@@ -21,6 +21,7 @@
 
 #pragma once
 #include "StepIdentifier.h"
+#include "catapult/crypto/Signer.h"
 #include "catapult/crypto_voting/BmTreeSignature.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/model/TrailingVariableDataLayout.h"
@@ -133,5 +134,22 @@ namespace catapult { namespace model {
 	/// Processes a finalization \a message using \a context.
 	std::pair<ProcessMessageResult, size_t> ProcessMessage(const FinalizationMessage& message, const FinalizationContext& context);
 
+	/// Processes a finalization \a message with a previously verified signature using \a context.
+	/// \note This performs all checks performed by ProcessMessage except for signature verification.
+	std::pair<ProcessMessageResult, size_t> ProcessMessageWithVerifiedSignature(
+			const FinalizationMessage& message,
+			const FinalizationContext& context);
+
+	// endregion
+
+	// region VerifyMessageSignatures
+
+	/// Verifies the signatures of all \a count messages pointed to by \a pMessages using \a randomFiller.
+	/// Returns a vector of bools that indicates the verification result for each individual message.
+	std::vector<bool> VerifyMessageSignatures(
+			const crypto::RandomFiller& randomFiller,
+			const std::shared_ptr<FinalizationMessage>* pMessages,
+			size_t count);
+
 	// endregion
 }}
@@ -302,6 +302,98 @@ namespace catapult { namespace finalization {
 		test::AssertEqualPayload(CreateBroadcastPayload({ pMessage1, pMessage3 }), context.broadcastedPayloads()[0]);
 	}
 
+	TEST(TEST_CLASS, MessagesWithInvalidSignaturesAreIgnored) {
+		// Arrange:
+		TestContext context(FinalizationPoint(10));
+		context.boot();
+
+		const auto& hooks = GetFinalizationServerHooks(context.locator());
+		auto& aggregator = GetMultiRoundMessageAggregator(context.locator());
+		aggregator.modifier().setMaxFinalizationRound({ Finalization_Epoch, FinalizationPoint(12) });
+
+		// - prepare message(s)
+		const auto& hash = test::GenerateRandomByteArray<Hash256>();
+		auto pMessage1 = context.createMessage(VoterType::Large1, CreateStepIdentifier(12), Height(9), hash);
+		auto pMessage2 = context.createMessage(VoterType::Large1, CreateStepIdentifier(11), Height(8), hash);
+		auto pMessage3 = context.createMessage(VoterType::Large1, CreateStepIdentifier(10), Height(7), hash);
+
+		// - corrupt the signature of the second message
+		pMessage2->Signature.Bottom.Signature[0] ^= 0xFF;
+
+		// Act:
+		hooks.messageRangeConsumer()(CreateMessageRange({ pMessage1, pMessage2, pMessage3 }));
+
+		// - wait for the aggregator and the broadcast
+		WAIT_FOR_VALUE_EXPR(2u, aggregator.view().size());
+		WAIT_FOR_ONE_EXPR(context.numBroadcastCalls());
+
+		// Assert: check the aggregator
+		EXPECT_EQ(2u, aggregator.view().size());
+
+		// - check the packet(s)
+		ASSERT_EQ(1u, context.numBroadcastCalls());
+		test::AssertEqualPayload(CreateBroadcastPayload({ pMessage1, pMessage3 }), context.broadcastedPayloads()[0]);
+	}
+
+	TEST(TEST_CLASS, DuplicateMessagesWithinRangeAreProcessedOnce) {
+		// Arrange:
+		TestContext context(FinalizationPoint(10));
+		context.boot();
+
+		const auto& hooks = GetFinalizationServerHooks(context.locator());
+		auto& aggregator = GetMultiRoundMessageAggregator(context.locator());
+		aggregator.modifier().setMaxFinalizationRound({ Finalization_Epoch, FinalizationPoint(12) });
+
+		// - prepare message(s)
+		const auto& hash = test::GenerateRandomByteArray<Hash256>();
+		auto pMessage1 = context.createMessage(VoterType::Large1, CreateStepIdentifier(12), Height(9), hash);
+		auto pMessage2 = context.createMessage(VoterType::Large1, CreateStepIdentifier(11), Height(8), hash);
+
+		// Act:
+		hooks.messageRangeConsumer()(CreateMessageRange({ pMessage1, pMessage2, pMessage1, pMessage2, pMessage1 }));
+
+		// - wait for the aggregator and the broadcast
+		WAIT_FOR_VALUE_EXPR(2u, aggregator.view().size());
+		WAIT_FOR_ONE_EXPR(context.numBroadcastCalls());
+
+		// Assert: check the aggregator
+		EXPECT_EQ(2u, aggregator.view().size());
+
+		// - check the packet(s)
+		ASSERT_EQ(1u, context.numBroadcastCalls());
+		test::AssertEqualPayload(CreateBroadcastPayload({ pMessage1, pMessage2 }), context.broadcastedPayloads()[0]);
+	}
+
+	TEST(TEST_CLASS, ManyMessagesAreVerifiedInParallelAndForwarded) {
+		// Arrange:
+		TestContext context(FinalizationPoint(1));
+		context.boot();
+
+		const auto& hooks = GetFinalizationServerHooks(context.locator());
+		auto& aggregator = GetMultiRoundMessageAggregator(context.locator());
+		aggregator.modifier().setMaxFinalizationRound({ Finalization_Epoch, FinalizationPoint(50) });
+
+		// - prepare message(s) spanning multiple partitions
+		FinalizationMessages messages;
+		const auto& hash = test::GenerateRandomByteArray<Hash256>();
+		for (auto i = 1u; i <= 50; ++i)
+			messages.push_back(context.createMessage(VoterType::Large1, CreateStepIdentifier(i), Height(10), hash));
+
+		// Act:
+		hooks.messageRangeConsumer()(CreateMessageRange(messages));
+
+		// - wait for the aggregator and the broadcast
+		WAIT_FOR_VALUE_EXPR(50u, aggregator.view().size());
+		WAIT_FOR_ONE_EXPR(context.numBroadcastCalls());
+
+		// Assert: check the aggregator
+		EXPECT_EQ(50u, aggregator.view().size());
+
+		// - check the packet(s)
+		ASSERT_EQ(1u, context.numBroadcastCalls());
+		test::AssertEqualPayload(CreateBroadcastPayload(messages), context.broadcastedPayloads()[0]);
+	}
+
 	TEST(TEST_CLASS, MessageWithHigherFinalizationPointCanBeProcessedAfterLocalFinalizationPointIncreases) {
 		// Arrange:
 		TestContext context(FinalizationPoint(10));
@@ -276,6 +276,43 @@ namespace catapult { namespace chain {
 		AssertCanAddMessage(Default_Min_Round + FinalizationPoint(5), RoundMessageAggregatorAddResult::Failure_Invalid_Height);
 	}
 
+	TEST(TEST_CLASS, CannotAddMessageWithVerifiedSignatureWithPointGreaterThanMax) {
+		// Arrange:
+		TestContext context;
+		context.aggregator().modifier().setMaxFinalizationRound(Default_Max_Round);
+
+		// Act:
+		auto pMessage = CreateMessage(Default_Max_Round + FinalizationPoint(1), Height(222));
+		auto result = context.aggregator().modifier().addWithVerifiedSignature(std::move(pMessage));
+
+		// Assert:
+		EXPECT_EQ(RoundMessageAggregatorAddResult::Failure_Invalid_Point, result);
+		EXPECT_EQ(0u, context.aggregator().view().size());
+		EXPECT_EQ(0u, context.roundMessageAggregators().size());
+	}
+
+	TEST(TEST_CLASS, CanAddMessageWithVerifiedSignatureWithPointBetweenMinAndMax) {
+		// Arrange:
+		TestContext context;
+		context.aggregator().modifier().setMaxFinalizationRound(Default_Max_Round);
+		context.setRoundMessageAggregatorInitializer([](auto& roundMessageAggregator) {
+			roundMessageAggregator.setAddResult(RoundMessageAggregatorAddResult::Success_Prevote);
+		});
+
+		// Act:
+		auto pMessage = CreateMessage(Default_Min_Round + FinalizationPoint(5), Height(222));
+		auto result = context.aggregator().modifier().addWithVerifiedSignature(std::move(pMessage));
+
+		// Assert: round aggregator is forwarded the message via addWithVerifiedSignature
+		EXPECT_EQ(RoundMessageAggregatorAddResult::Success_Prevote, result);
+		EXPECT_EQ(1u, context.aggregator().view().size());
+		ASSERT_EQ(1u, context.roundMessageAggregators().size());
+
+		EXPECT_EQ(Default_Min_Round + FinalizationPoint(5), context.roundMessageAggregators()[0]->round());
+		EXPECT_EQ(1u, context.roundMessageAggregators()[0]->numAddCalls());
+		EXPECT_EQ(1u, context.roundMessageAggregators()[0]->numAddWithVerifiedSignatureCalls());
+	}
+
 	TEST(TEST_CLASS, CanAddMultipleMessagesWithSamePoint) {
 		// Arrange:
 		TestContext context;
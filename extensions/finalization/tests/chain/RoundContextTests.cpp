@@ -382,11 +382,28 @@ namespace catapult { namespace chain {
 		});
 	}
 
+	TEST(TEST_CLASS, EstimateExistsWhenDistantBestPrevoteAncestorCanReachPrecommitThreshold) {
+		// Arrange: 7 - ... - 206
+		auto hashes = test::GenerateRandomDataVector<Hash256>(200);
+
+		RoundContext context(1000, 670);
+		context.acceptPrevote(Height(7), hashes.data(), hashes.size(), 700);
+		context.acceptPrecommit(Height(33), hashes[26], 400);
+		context.acceptPrecommit(Height(190), hashes[183], 200);
+
+		// Act + Assert: remaining weight is 400, so only candidates with at least 270 precommits can reach threshold
+		AssertSet({ Height(206), hashes[199] }, context.tryFindBestPrevote());
+		AssertSet({ Height(33), hashes[26] }, context.tryFindEstimate());
+
+		// Sanity:
+		EXPECT_TRUE(context.isCompletable());
+	}
+
 	// endregion
 
 	// region isDescendant
 
-	TEST(TEST_CLASS, IsDescendantDelegatesToFinalizationHashTree) {
+	TEST(TEST_CLASS, IsDescendantReturnsTrueOnlyForInclusiveDescendants) {
 		// Arrange:
 		//  7 - 8 - 9 - 10      |
 		//     ||| |||          |
@@ -409,6 +426,49 @@ namespace catapult { namespace chain {
 		EXPECT_FALSE(context.isDescendant({ Height(9), hashes1[2] }, { Height(11), hashes2[0] })); // unknown child
 	}
 
+	TEST(TEST_CLASS, IsDescendantSupportsLongBranches) {
+		// Arrange:
+		//  7 - ... - 106 - ... - 206 | (hashes1)
+		//             |||            |
+		//            106 - ... - 156 | (hashes2)
+		auto hashes1 = test::GenerateRandomDataVector<Hash256>(200);
+		auto hashes2 = test::GenerateRandomDataVector<Hash256>(51);
+		hashes2[0] = hashes1[99];
+
+		RoundContext context(1000, 670);
+		context.acceptPrevote(Height(7), hashes1.data(), hashes1.size(), 250);
+		context.acceptPrevote(Height(106), hashes2.data(), hashes2.size(), 200);
+
+		// Act + Assert:
+		EXPECT_TRUE(context.isDescendant({ Height(7), hashes1[0] }, { Height(206), hashes1[199] }));
+		EXPECT_TRUE(context.isDescendant({ Height(7), hashes1[0] }, { Height(156), hashes2[50] }));
+		EXPECT_TRUE(context.isDescendant({ Height(50), hashes1[43] }, { Height(133), hashes2[27] }));
+		EXPECT_TRUE(context.isDescendant({ Height(106), hashes1[99] }, { Height(156), hashes2[50] }));
+
+		EXPECT_FALSE(context.isDescendant({ Height(107), hashes1[100] }, { Height(156), hashes2[50] })); // sibling branch
+		EXPECT_FALSE(context.isDescendant({ Height(156), hashes1[149] }, { Height(156), hashes2[50] })); // same height
+		EXPECT_FALSE(context.isDescendant({ Height(50), hashes1[0] }, { Height(206), hashes1[199] })); // wrong height
+	}
+
+	TEST(TEST_CLASS, IsDescendantSupportsPrevotesAtDecreasingHeights) {
+		// Arrange: prevote higher branch before lower branch
+		auto hashes1 = test::GenerateRandomDataVector<Hash256>(3);
+		auto hashes2 = test::GenerateRandomDataVector<Hash256>(5);
+
+		RoundContext context(1000, 670);
+		context.acceptPrevote(Height(20), hashes1.data(), hashes1.size(), 250);
+		context.acceptPrevote(Height(7), hashes2.data(), hashes2.size(), 200);
+
+		// Act + Assert:
+		EXPECT_EQ(8u, context.size());
+		EXPECT_TRUE(context.isDescendant({ Height(20), hashes1[0] }, { Height(22), hashes1[2] }));
+		EXPECT_TRUE(context.isDescendant({ Height(7), hashes2[0] }, { Height(11), hashes2[4] }));
+		EXPECT_FALSE(context.isDescendant({ Height(7), hashes2[0] }, { Height(22), hashes1[2] }));
+
+		EXPECT_EQ(RoundContext::Weights({ 250, 0 }), context.weights({ Height(20), hashes1[0] }));
+		EXPECT_EQ(RoundContext::Weights({ 200, 0 }), context.weights({ Height(7), hashes2[0] }));
+	}
+
 	// endregion
 
 	// region isCompletable
@@ -243,6 +243,41 @@ namespace catapult { namespace chain {
 		EXPECT_EQ(0u, context.aggregator().size());
 	}
 
+	PREVOTE_PRECOMIT_TEST(CannotAddMessageWithIneligibleSignerWhenSignatureIsVerified) {
+		// Arrange:
+		auto pMessage = test::CreateMessage(Last_Finalized_Height + Height(1), 1);
+		pMessage->StepIdentifier = { Finalization_Epoch, Finalization_Point, TTraits::Stage };
+
+		TestContext context(1000, 700);
+		context.signMessage(*pMessage, 2);
+
+		// Act:
+		auto result = context.aggregator().addWithVerifiedSignature(std::move(pMessage));
+
+		// Assert:
+		EXPECT_EQ(RoundMessageAggregatorAddResult::Failure_Processing, result);
+		EXPECT_EQ(0u, context.aggregator().size());
+	}
+
+	PREVOTE_PRECOMIT_TEST(CanAddMessageWithInvalidSignatureWhenSignatureIsVerified) {
+		// Arrange:
+		auto pMessage = test::CreateMessage(Last_Finalized_Height + Height(1), 1);
+		pMessage->StepIdentifier = { Finalization_Epoch, Finalization_Point, TTraits::Stage };
+
+		TestContext context(1000, 700);
+		context.signMessage(*pMessage, 0);
+
+		// - corrupt the signature
+		pMessage->HashesPtr()[0][0] ^= 0xFF;
+
+		// Act: signature is assumed to have been verified by the caller
+		auto result = context.aggregator().addWithVerifiedSignature(std::move(pMessage));
+
+		// Assert:
+		EXPECT_EQ(TTraits::Success_Result, result);
+		EXPECT_EQ(1u, context.aggregator().size());
+	}
+
 	namespace {
 		template<typename TTraits>
 		void AssertCannotAddMessageWithInvalidHeight(uint32_t numHashes, std::initializer_list<int64_t> heightDeltas) {
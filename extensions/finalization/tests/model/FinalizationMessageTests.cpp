@@ -21,6 +21,7 @@
 
 #include "finalization/src/model/FinalizationMessage.h"
 #include "catapult/crypto_voting/AggregateBmPrivateKeyTree.h"
+#include "catapult/utils/RandomGenerator.h"
 #include "finalization/tests/test/FinalizationMessageTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/HashTestUtils.h"
@@ -460,4 +461,113 @@ namespace catapult { namespace model {
 	}
 
 	// endregion
+
+	// region ProcessMessageWithVerifiedSignature
+
+	TEST(TEST_CLASS, ProcessMessageWithVerifiedSignature_DoesNotCheckSignature) {
+		// Arrange:
+		RunProcessMessageTest(VoterType::Large, 3, [](const auto& context, const auto&, auto& message) {
+			// - corrupt a hash
+			test::FillWithRandomData(message.HashesPtr()[1]);
+
+			// Act:
+			auto processResultPair = ProcessMessageWithVerifiedSignature(message, context);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Success, processResultPair.first);
+			EXPECT_EQ(Expected_Large_Weight, processResultPair.second);
+		});
+	}
+
+	TEST(TEST_CLASS, ProcessMessageWithVerifiedSignature_FailsWhenReservedDataIsNotCleared) {
+		// Arrange:
+		auto modifyMessage = [](auto& message) { message.FinalizationMessage_Reserved1 = 1; };
+		RunProcessMessageTest(VoterType::Large, 3, modifyMessage, [](const auto& context, const auto&, const auto& message) {
+			// Act:
+			auto processResultPair = ProcessMessageWithVerifiedSignature(message, context);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Failure_Padding, processResultPair.first);
+			EXPECT_EQ(0u, processResultPair.second);
+		});
+	}
+
+	TEST(TEST_CLASS, ProcessMessageWithVerifiedSignature_FailsWhenVersionIsIncorrect) {
+		// Arrange:
+		auto modifyMessage = [](auto& message) { ++message.Version; };
+		RunProcessMessageTest(VoterType::Large, 3, modifyMessage, [](const auto& context, const auto&, const auto& message) {
+			// Act:
+			auto processResultPair = ProcessMessageWithVerifiedSignature(message, context);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Failure_Version, processResultPair.first);
+			EXPECT_EQ(0u, processResultPair.second);
+		});
+	}
+
+	TEST(TEST_CLASS, ProcessMessageWithVerifiedSignature_FailsWhenAccountIsNotVotingEligible) {
+		// Arrange:
+		RunProcessMessageTest(VoterType::Ineligible, 3, [](const auto& context, const auto&, const auto& message) {
+			// Act:
+			auto processResultPair = ProcessMessageWithVerifiedSignature(message, context);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Failure_Voter, processResultPair.first);
+			EXPECT_EQ(0u, processResultPair.second);
+		});
+	}
+
+	// endregion
+
+	// region VerifyMessageSignatures
+
+	namespace {
+		std::vector<std::shared_ptr<FinalizationMessage>> CreateSignedMessages(size_t count) {
+			auto votingKeyPair = test::GenerateVotingKeyPair();
+
+			std::vector<std::shared_ptr<FinalizationMessage>> messages;
+			for (auto i = 0u; i < count; ++i) {
+				auto pMessage = CreateMessage(3);
+				pMessage->StepIdentifier = DefaultStepIdentifier();
+				test::SignMessage(*pMessage, votingKeyPair);
+				messages.push_back(std::move(pMessage));
+			}
+
+			return messages;
+		}
+
+		crypto::RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				// can use low entropy source for tests
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_SucceedsWhenAllSignaturesAreValid) {
+		// Arrange:
+		auto messages = CreateSignedMessages(10);
+
+		// Act:
+		auto results = VerifyMessageSignatures(CreateRandomFiller(), messages.data(), messages.size());
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(10, true), results);
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_DetectsInvalidSignatures) {
+		// Arrange:
+		auto messages = CreateSignedMessages(10);
+		test::FillWithRandomData(messages[2]->HashesPtr()[1]);
+		messages[5]->StepIdentifier.Epoch = messages[5]->StepIdentifier.Epoch + FinalizationEpoch(1);
+		messages[7]->Signature.Bottom.Signature[3] ^= 0xFF;
+
+		// Act:
+		auto results = VerifyMessageSignatures(CreateRandomFiller(), messages.data(), messages.size());
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>({ true, true, false, true, true, false, true, false, true, true }), results);
+	}
+
+	// endregion
 }}
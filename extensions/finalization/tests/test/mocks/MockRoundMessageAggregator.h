@@ -33,6 +33,7 @@ namespace catapult { namespace mocks {
 		explicit MockRoundMessageAggregator(const model::FinalizationRound& round)
 				: m_round(round)
 				, m_numAddCalls(0)
+				, m_numAddWithVerifiedSignatureCalls(0)
 				, m_roundContext(1000, 700)
 				, m_addResult(static_cast<chain::RoundMessageAggregatorAddResult>(-1))
 		{}
@@ -48,11 +49,16 @@ namespace catapult { namespace mocks {
 			return m_roundContext;
 		}
 
-		/// Gets the number of times add was called.
+		/// Gets the number of times add or addWithVerifiedSignature was called.
 		size_t numAddCalls() const {
 			return m_numAddCalls;
 		}
 
+		/// Gets the number of times addWithVerifiedSignature was called.
+		size_t numAddWithVerifiedSignatureCalls() const {
+			return m_numAddWithVerifiedSignatureCalls;
+		}
+
 	public:
 		/// Sets the result of shortHashes to \a shortHashes.
 		void setShortHashes(model::ShortHashRange&& shortHashes) {
@@ -103,10 +109,17 @@ namespace catapult { namespace mocks {
 			return m_addResult;
 		}
 
+		chain::RoundMessageAggregatorAddResult addWithVerifiedSignature(const std::shared_ptr<model::FinalizationMessage>&) override {
+			++m_numAddCalls;
+			++m_numAddWithVerifiedSignatureCalls;
+			return m_addResult;
+		}
+
 	private:
 		model::FinalizationRound m_round;
 		Height m_height;
 		size_t m_numAddCalls;
+		size_t m_numAddWithVerifiedSignatureCalls;
 		chain::RoundContext m_roundContext;
 
 		model::ShortHashRange m_shortHashes;
@@ -33,7 +33,6 @@
 #include "src/MongoTransactionStorage.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/extensions/RootedService.h"
-#include "catapult/io/BlockStorageChangeSubscriber.h"
 #include <mongocxx/instance.hpp>
 
 namespace catapult { namespace mongo {
@@ -123,6 +122,8 @@ namespace catapult { namespace mongo {
 			auto pMongoBlockStorage = CreateMongoBlockStorage(
 					*pMongoContext,
 					dbConfig.MaxDropBatchSize,
+					dbConfig.MaxWriteBatchBlocks,
+					dbConfig.MaxWriteBatchDelay,
 					*pTransactionRegistry,
 					pPluginManager->receiptRegistry());
 
@@ -131,8 +132,7 @@ namespace catapult { namespace mongo {
 			EmptyCollection(*pMongoContext, Pt_Collection_Name);
 
 			// register subscriptions
-			bootstrapper.subscriptionManager().addBlockChangeSubscriber(
-					io::CreateBlockStorageChangeSubscriber(std::move(pMongoBlockStorage)));
+			bootstrapper.subscriptionManager().addBlockChangeSubscriber(CreateMongoBlockChangeSubscriber(std::move(pMongoBlockStorage)));
 			bootstrapper.subscriptionManager().addPtChangeSubscriber(CreateMongoPtStorage(*pMongoContext, *pTransactionRegistry));
 			bootstrapper.subscriptionManager().addUtChangeSubscriber(
 					CreateMongoTransactionStorage(*pMongoContext, *pTransactionRegistry, Ut_Collection_Name));
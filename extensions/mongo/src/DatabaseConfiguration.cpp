@@ -42,13 +42,15 @@ namespace catapult { namespace mongo {
 		LOAD_DB_PROPERTY(MaxWriterThreads);
 		LOAD_DB_PROPERTY(MaxDropBatchSize);
 		LOAD_DB_PROPERTY(WriteTimeout);
+		LOAD_DB_PROPERTY(MaxWriteBatchBlocks);
+		LOAD_DB_PROPERTY(MaxWriteBatchDelay);
 
 #undef LOAD_DB_PROPERTY
 
 		auto pluginsPair = utils::ExtractSectionAsUnorderedSet(bag, "plugins");
 		config.Plugins = pluginsPair.first;
 
-		utils::VerifyBagSizeExact(bag, 5 + pluginsPair.second);
+		utils::VerifyBagSizeExact(bag, 7 + pluginsPair.second);
 		return config;
 	}
 
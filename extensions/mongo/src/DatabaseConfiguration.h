@@ -47,6 +47,13 @@ namespace catapult { namespace mongo {
 		/// Write timeout.
 		utils::TimeSpan WriteTimeout;
 
+		/// Maximum number of blocks to accumulate before writing them to the database.
+		/// \note Batching is disabled when this is one.
+		uint32_t MaxWriteBatchBlocks;
+
+		/// Maximum amount of time to accumulate blocks before writing them to the database.
+		utils::TimeSpan MaxWriteBatchDelay;
+
 		/// Named database plugins to enable.
 		std::unordered_set<std::string> Plugins;
 
@@ -29,6 +29,7 @@
 #include "mappers/ResolutionStatementMapper.h"
 #include "mappers/TransactionMapper.h"
 #include "mappers/TransactionStatementMapper.h"
+#include "catapult/utils/StackTimer.h"
 
 using namespace bsoncxx::builder::stream;
 
@@ -66,28 +67,31 @@ namespace catapult { namespace mongo {
 				CATAPULT_THROW_RUNTIME_ERROR("SaveBlockHeader failed: block header was not inserted");
 		}
 
-		size_t SaveTransactions(
+		thread::future<size_t> SaveTransactions(
 				MongoBulkWriter& bulkWriter,
 				Height height,
 				const std::vector<model::TransactionElement>& transactions,
 				const MongoTransactionRegistry& registry,
 				const MongoErrorPolicy& errorPolicy) {
-			std::atomic<size_t> totalTransactionsCount(0);
-			auto createDocuments = [height, &registry, &totalTransactionsCount](const auto& transactionElement, auto index) {
+			auto pTotalTransactionsCount = std::make_shared<std::atomic<size_t>>(0);
+			auto createDocuments = [height, &registry, pTotalTransactionsCount](const auto& transactionElement, auto index) {
 				auto metadata = MongoTransactionMetadata(transactionElement, height, index);
 				auto documents = mappers::ToDbDocuments(transactionElement.Transaction, metadata, registry);
-				totalTransactionsCount += documents.size();
+				*pTotalTransactionsCount += documents.size();
 				return documents;
 			};
-			auto results = bulkWriter.bulkInsert("transactions", transactions, createDocuments).get();
-			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(results)));
 
-			auto itemsDescription = "transactions at height " + std::to_string(height.unwrap());
-			errorPolicy.checkInserted(totalTransactionsCount, aggregateResult, itemsDescription);
-			return totalTransactionsCount;
+			auto resultsFuture = bulkWriter.bulkInsert("transactions", transactions, createDocuments);
+			return resultsFuture.then([height, pTotalTransactionsCount, &errorPolicy](auto&& completedResultsFuture) {
+				auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(completedResultsFuture.get()));
+
+				auto itemsDescription = "transactions at height " + std::to_string(height.unwrap());
+				errorPolicy.checkInserted(*pTotalTransactionsCount, aggregateResult, itemsDescription);
+				return static_cast<size_t>(*pTotalTransactionsCount);
+			});
 		}
 
-		void SaveBlockStatement(
+		thread::future<bool> SaveBlockStatement(
 				MongoBulkWriter& bulkWriter,
 				Height height,
 				const model::BlockStatement& blockStatement,
@@ -122,8 +126,7 @@ namespace catapult { namespace mongo {
 				return mappers::ToDbModel(height, pair.second);
 			}));
 
-			auto statementsFuture = thread::when_all(std::move(futures)).then([height, numExpectedInserts, &errorPolicy](
-					auto&& resultsFuture) {
+			return thread::when_all(std::move(futures)).then([height, numExpectedInserts, &errorPolicy](auto&& resultsFuture) {
 				auto insertResultsContainer = resultsFuture.get();
 				auto i = 0u;
 				auto itemsDescription = "statements at height " + std::to_string(height.unwrap());
@@ -133,19 +136,35 @@ namespace catapult { namespace mongo {
 					++i;
 				}
 			});
+		}
 
-			statementsFuture.get();
+		using Documents = std::vector<bsoncxx::document::value>;
+
+		struct BlockDocuments {
+			Documents Blocks;
+			Documents Transactions;
+			Documents TransactionStatements;
+			Documents AddressResolutionStatements;
+			Documents MosaicResolutionStatements;
+		};
+
+		void MoveAppend(Documents& destination, Documents& source) {
+			destination.insert(destination.end(), std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()));
 		}
 
-		class MongoBlockStorage final : public io::LightBlockStorage {
+		class DefaultMongoBlockStorage final : public MongoBlockStorage {
 		public:
-			MongoBlockStorage(
+			DefaultMongoBlockStorage(
 					MongoStorageContext& context,
 					uint32_t maxDropBatchSize,
+					uint32_t maxWriteBatchBlocks,
+					const utils::TimeSpan& maxWriteBatchDelay,
 					const MongoTransactionRegistry& transactionRegistry,
 					const MongoReceiptRegistry& receiptRegistry)
 					: m_context(context)
 					, m_maxDropBatchSize(maxDropBatchSize)
+					, m_maxWriteBatchBlocks(maxWriteBatchBlocks)
+					, m_maxWriteBatchDelay(maxWriteBatchDelay)
 					, m_transactionRegistry(transactionRegistry)
 					, m_receiptRegistry(receiptRegistry)
 					, m_database(m_context.createDatabaseConnection())
@@ -184,17 +203,43 @@ namespace catapult { namespace mongo {
 					dropAllAfter(height - Height(1)); // forcibly drop orphaned documents
 				}
 
-				auto dbHeight = chainHeight();
+				// pending blocks always start right after the chain height
+				auto chainHeightValue = Height(0) != m_pendingEndHeight ? m_pendingStartHeight - Height(1) : chainHeight();
+				if (height <= chainHeightValue) {
+					// block has already been written, e.g. by a batch that is being replayed after a failure
+					CATAPULT_LOG(debug) << "skipping block with height " << height << " when storage height is " << chainHeightValue;
+					return;
+				}
+
+				auto dbHeight = Height(0) != m_pendingEndHeight ? m_pendingEndHeight : chainHeightValue;
 				if (height != dbHeight + Height(1)) {
 					std::ostringstream out;
 					out << "cannot save block with height " << height << " when storage height is " << dbHeight;
 					CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
 				}
 
-				saveBlockInternal(blockElement);
+				if (!isBatchingEnabled()) {
+					saveBlockInternal(blockElement);
+					return;
+				}
+
+				if (Height(0) == m_pendingEndHeight) {
+					m_pendingStartHeight = height;
+					m_batchTimer = utils::StackTimer();
+				}
+
+				// map documents immediately because blockElement is not guaranteed to outlive this call
+				appendBlockDocuments(blockElement);
+				m_pendingEndHeight = height;
+
+				auto numPendingBlocks = (m_pendingEndHeight - m_pendingStartHeight).unwrap() + 1;
+				if (numPendingBlocks >= m_maxWriteBatchBlocks || m_batchTimer.millis() >= m_maxWriteBatchDelay.millis())
+					flush();
 			}
 
 			void dropBlocksAfter(Height height) override {
+				flush();
+
 				auto dbHeight = chainHeight();
 				if (dbHeight <= height)
 					return;
@@ -205,24 +250,135 @@ namespace catapult { namespace mongo {
 
 			// endregion
 
+			// region MongoBlockStorage
+
+			void flush() override {
+				if (Height(0) == m_pendingEndHeight)
+					return;
+
+				// clear pending state before writing so that a failed write does not leave partially written blocks pending
+				auto blockDocuments = std::move(m_pendingDocuments);
+				auto startHeight = m_pendingStartHeight;
+				auto endHeight = m_pendingEndHeight;
+				m_pendingDocuments = BlockDocuments();
+				m_pendingStartHeight = Height(0);
+				m_pendingEndHeight = Height(0);
+
+				std::ostringstream heightsDescriptionStream;
+				heightsDescriptionStream << " at heights " << startHeight << " - " << endHeight;
+				auto heightsDescription = heightsDescriptionStream.str();
+				CATAPULT_LOG(debug) << "writing blocks" << heightsDescription;
+
+				// chain height acts as the commit marker, so it must be set after all other documents have been written
+				insertAll({
+					{ "transactions", &blockDocuments.Transactions },
+					{ "transactionStatements", &blockDocuments.TransactionStatements },
+					{ "addressResolutionStatements", &blockDocuments.AddressResolutionStatements },
+					{ "mosaicResolutionStatements", &blockDocuments.MosaicResolutionStatements }
+				}, heightsDescription);
+				insertAll({ { "blocks", &blockDocuments.Blocks } }, heightsDescription);
+				setHeight(endHeight);
+			}
+
+			// endregion
+
 		private:
+			bool isBatchingEnabled() const {
+				// batching is disabled in idempotent mode because orphaned documents are dropped relative to the chain height
+				return m_maxWriteBatchBlocks > 1 && MongoErrorPolicy::Mode::Idempotent != m_errorPolicy.mode();
+			}
+
+			void appendBlockDocuments(const model::BlockElement& blockElement) {
+				// map into separate documents so that pending documents are unchanged when mapping fails
+				BlockDocuments blockDocuments;
+				auto height = blockElement.Block.Height;
+
+				auto index = 0u;
+				for (const auto& transactionElement : blockElement.Transactions) {
+					auto metadata = MongoTransactionMetadata(transactionElement, height, index++);
+					auto transactionDocuments = mappers::ToDbDocuments(transactionElement.Transaction, metadata, m_transactionRegistry);
+					for (auto& transactionDocument : transactionDocuments)
+						blockDocuments.Transactions.push_back(std::move(transactionDocument));
+				}
+
+				auto numTransactionDocuments = static_cast<uint32_t>(blockDocuments.Transactions.size());
+				blockDocuments.Blocks.push_back(mappers::ToDbModel(blockElement, numTransactionDocuments));
+
+				if (blockElement.OptionalStatement) {
+					const auto& blockStatement = *blockElement.OptionalStatement;
+					for (const auto& pair : blockStatement.TransactionStatements)
+						blockDocuments.TransactionStatements.push_back(mappers::ToDbModel(height, pair.second, m_receiptRegistry));
+
+					for (const auto& pair : blockStatement.AddressResolutionStatements)
+						blockDocuments.AddressResolutionStatements.push_back(mappers::ToDbModel(height, pair.second));
+
+					for (const auto& pair : blockStatement.MosaicResolutionStatements)
+						blockDocuments.MosaicResolutionStatements.push_back(mappers::ToDbModel(height, pair.second));
+				}
+
+				MoveAppend(m_pendingDocuments.Blocks, blockDocuments.Blocks);
+				MoveAppend(m_pendingDocuments.Transactions, blockDocuments.Transactions);
+				MoveAppend(m_pendingDocuments.TransactionStatements, blockDocuments.TransactionStatements);
+				MoveAppend(m_pendingDocuments.AddressResolutionStatements, blockDocuments.AddressResolutionStatements);
+				MoveAppend(m_pendingDocuments.MosaicResolutionStatements, blockDocuments.MosaicResolutionStatements);
+			}
+
+			void insertAll(
+					const std::vector<std::pair<std::string, const Documents*>>& collectionDocumentsPairs,
+					const std::string& heightsDescription) {
+				using BulkWriteResultFuture = thread::future<std::vector<thread::future<BulkWriteResult>>>;
+
+				std::vector<BulkWriteResultFuture> futures;
+				for (const auto& pair : collectionDocumentsPairs)
+					futures.push_back(m_context.bulkWriter().bulkInsert(pair.first, *pair.second));
+
+				// wait for all writes before checking any results because they reference the documents
+				auto insertResultsContainer = thread::when_all(std::move(futures)).get();
+				auto i = 0u;
+				for (auto& insertResults : insertResultsContainer) {
+					const auto& pair = collectionDocumentsPairs[i++];
+					auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(insertResults.get())));
+					m_errorPolicy.checkInserted(pair.second->size(), aggregateResult, pair.first + heightsDescription);
+				}
+			}
+
 			void saveBlockInternal(const model::BlockElement& blockElement) {
+				// start mapping and writing statements and transactions concurrently
 				auto height = blockElement.Block.Height;
-				auto totalTransactionsCount = saveTransactions(height, blockElement.Transactions);
+				auto statementsFuture = blockElement.OptionalStatement
+						? saveBlockStatement(height, *blockElement.OptionalStatement)
+						: thread::make_ready_future(true);
+				auto transactionsFuture = saveTransactions(height, blockElement.Transactions);
+
+				// wait for both writes before checking results because they reference blockElement
+				std::exception_ptr pException;
+				size_t totalTransactionsCount = 0;
+				try {
+					totalTransactionsCount = transactionsFuture.get();
+				} catch (...) {
+					pException = std::current_exception();
+				}
 
-				if (blockElement.OptionalStatement)
-					saveBlockStatement(height, *blockElement.OptionalStatement);
+				try {
+					statementsFuture.get();
+				} catch (...) {
+					if (!pException)
+						pException = std::current_exception();
+				}
+
+				if (pException)
+					std::rethrow_exception(pException);
 
 				SaveBlockHeader(m_database, blockElement, static_cast<uint32_t>(totalTransactionsCount));
 				setHeight(height);
 			}
 
-			size_t saveTransactions(Height height, const std::vector<model::TransactionElement>& transactions) {
+			thread::future<size_t> saveTransactions(Height height, const std::vector<model::TransactionElement>& transactions) {
 				return SaveTransactions(m_context.bulkWriter(), height, transactions, m_transactionRegistry, m_errorPolicy);
 			}
 
-			void saveBlockStatement(Height height, const model::BlockStatement& blockStatement) {
-				SaveBlockStatement(m_context.bulkWriter(), height, blockStatement, m_receiptRegistry, m_errorPolicy);
+			thread::future<bool> saveBlockStatement(Height height, const model::BlockStatement& blockStatement) {
+				return SaveBlockStatement(m_context.bulkWriter(), height, blockStatement, m_receiptRegistry, m_errorPolicy);
 			}
 
 			void setHeight(Height height) {
@@ -279,18 +435,67 @@ namespace catapult { namespace mongo {
 		private:
 			MongoStorageContext& m_context;
 			uint32_t m_maxDropBatchSize;
+			uint32_t m_maxWriteBatchBlocks;
+			utils::TimeSpan m_maxWriteBatchDelay;
 			const MongoTransactionRegistry& m_transactionRegistry;
 			const MongoReceiptRegistry& m_receiptRegistry;
 			MongoDatabase m_database;
 			MongoErrorPolicy m_errorPolicy;
+
+			BlockDocuments m_pendingDocuments;
+			Height m_pendingStartHeight;
+			Height m_pendingEndHeight;
+			utils::StackTimer m_batchTimer;
+		};
+
+		class MongoBlockChangeSubscriber : public io::BlockChangeSubscriber {
+		public:
+			explicit MongoBlockChangeSubscriber(std::unique_ptr<MongoBlockStorage>&& pStorage) : m_pStorage(std::move(pStorage))
+			{}
+
+		public:
+			void notifyBlock(const model::BlockElement& blockElement) override {
+				m_pStorage->saveBlock(blockElement);
+			}
+
+			void notifyDropBlocksAfter(Height height) override {
+				m_pStorage->dropBlocksAfter(height);
+			}
+
+			void flush() override {
+				m_pStorage->flush();
+			}
+
+		private:
+			std::unique_ptr<MongoBlockStorage> m_pStorage;
 		};
 	}
 
-	std::unique_ptr<io::LightBlockStorage> CreateMongoBlockStorage(
+	std::unique_ptr<MongoBlockStorage> CreateMongoBlockStorage(
 			MongoStorageContext& context,
 			uint32_t maxDropBatchSize,
 			const MongoTransactionRegistry& transactionRegistry,
 			const MongoReceiptRegistry& receiptRegistry) {
-		return std::make_unique<MongoBlockStorage>(context, maxDropBatchSize, transactionRegistry, receiptRegistry);
+		return CreateMongoBlockStorage(context, maxDropBatchSize, 1, utils::TimeSpan(), transactionRegistry, receiptRegistry);
+	}
+
+	std::unique_ptr<MongoBlockStorage> CreateMongoBlockStorage(
+			MongoStorageContext& context,
+			uint32_t maxDropBatchSize,
+			uint32_t maxWriteBatchBlocks,
+			const utils::TimeSpan& maxWriteBatchDelay,
+			const MongoTransactionRegistry& transactionRegistry,
+			const MongoReceiptRegistry& receiptRegistry) {
+		return std::make_unique<DefaultMongoBlockStorage>(
+				context,
+				maxDropBatchSize,
+				maxWriteBatchBlocks,
+				maxWriteBatchDelay,
+				transactionRegistry,
+				receiptRegistry);
+	}
+
+	std::unique_ptr<io::BlockChangeSubscriber> CreateMongoBlockChangeSubscriber(std::unique_ptr<MongoBlockStorage>&& pStorage) {
+		return std::make_unique<MongoBlockChangeSubscriber>(std::move(pStorage));
 	}
 }}
@@ -21,7 +21,9 @@
 
 #pragma once
 #include "MongoStorageContext.h"
+#include "catapult/io/BlockChangeSubscriber.h"
 #include "catapult/io/BlockStorage.h"
+#include "catapult/utils/TimeSpan.h"
 
 namespace catapult {
 	namespace mongo {
@@ -32,10 +34,31 @@ namespace catapult {
 
 namespace catapult { namespace mongo {
 
+	/// Mongodb block storage.
+	/// \note Saving a block at or below the chain height has no effect, so a replayed sequence of block changes is harmless.
+	class MongoBlockStorage : public io::LightBlockStorage {
+	public:
+		/// Writes all accumulated blocks to the database.
+		virtual void flush() = 0;
+	};
+
 	/// Creates a mongodb block storage around \a context, \a maxDropBatchSize, \a transactionRegistry and \a receiptRegistry.
-	std::unique_ptr<io::LightBlockStorage> CreateMongoBlockStorage(
+	std::unique_ptr<MongoBlockStorage> CreateMongoBlockStorage(
 			MongoStorageContext& context,
 			uint32_t maxDropBatchSize,
 			const MongoTransactionRegistry& transactionRegistry,
 			const MongoReceiptRegistry& receiptRegistry);
+
+	/// Creates a mongodb block storage around \a context, \a maxDropBatchSize, \a transactionRegistry and \a receiptRegistry
+	/// that accumulates up to \a maxWriteBatchBlocks blocks for at most \a maxWriteBatchDelay before writing them to the database.
+	std::unique_ptr<MongoBlockStorage> CreateMongoBlockStorage(
+			MongoStorageContext& context,
+			uint32_t maxDropBatchSize,
+			uint32_t maxWriteBatchBlocks,
+			const utils::TimeSpan& maxWriteBatchDelay,
+			const MongoTransactionRegistry& transactionRegistry,
+			const MongoReceiptRegistry& receiptRegistry);
+
+	/// Creates a block change subscriber around mongodb block storage (\a pStorage) that flushes the storage when flushed.
+	std::unique_ptr<io::BlockChangeSubscriber> CreateMongoBlockChangeSubscriber(std::unique_ptr<MongoBlockStorage>&& pStorage);
 }}
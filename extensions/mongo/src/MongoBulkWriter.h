@@ -27,6 +27,8 @@
 #include "catapult/thread/IoThreadPool.h"
 #include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/MemoryUtils.h"
+#include "catapult/utils/StackTimer.h"
+#include "catapult/utils/ThrottleLogger.h"
 #include "catapult/utils/TimeSpan.h"
 #include "catapult/exceptions.h"
 #include "catapult/types.h"
@@ -36,13 +38,96 @@
 #include <mongocxx/config/version.hpp>
 #include <mongocxx/exception/bulk_write_exception.hpp>
 #include <mongocxx/pool.hpp>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace catapult { namespace mongo {
 
 	/// Class for writing bulk data to the mongo database.
 	/// \note The bulk writer supports inserting, upserting and deleting documents.
+	/// \note Large writes are split into contiguous (key) ranges that are written unordered over separate pooled connections.
 	class MongoBulkWriter final : public std::enable_shared_from_this<MongoBulkWriter> {
+	public:
+		/// Number of write latency histogram buckets.
+		static constexpr size_t Num_Latency_Buckets = 4;
+
+		/// Exclusive upper bounds (in milliseconds) of all write latency histogram buckets except the last one.
+		static constexpr std::array<uint64_t, Num_Latency_Buckets - 1> Latency_Bucket_Bounds{ { 10, 100, 1000 } };
+
+		/// Initial number of entities mapped into a single bulk operation when there are more entities than worker threads.
+		static constexpr size_t Initial_Entities_Per_Partition = 500;
+
+		/// Minimum number of entities mapped into a single bulk operation when there are more entities than worker threads.
+		static constexpr size_t Min_Entities_Per_Partition = 100;
+
+		/// Maximum number of entities mapped into a single bulk operation when there are more entities than worker threads.
+		static constexpr size_t Max_Entities_Per_Partition = 5000;
+
+		/// Bulk operation latency (in milliseconds) targeted when adapting the number of entities per partition.
+		static constexpr uint64_t Target_Partition_Latency_Millis = 250;
+
+		/// Minimum interval (in milliseconds) between two logs of the bulk write statistics of all collections.
+		static constexpr uint64_t Statistics_Log_Interval_Millis = 60'000;
+
+		/// Bulk write statistics of a single collection.
+		struct CollectionStatistics {
+			/// Number of entities currently mapped into a single bulk operation.
+			size_t PartitionSize;
+
+			/// Number of bulk operations per latency bucket.
+			std::array<uint64_t, Num_Latency_Buckets> LatencyHistogram;
+		};
+
+	private:
+		class CollectionWriteState {
+		public:
+			CollectionWriteState() : m_partitionSize(Initial_Entities_Per_Partition) {
+				for (auto& bucket : m_latencyHistogram)
+					bucket = 0;
+			}
+
+		public:
+			size_t partitionSize() const {
+				return m_partitionSize;
+			}
+
+			CollectionStatistics statistics() const {
+				CollectionStatistics result;
+				result.PartitionSize = m_partitionSize;
+				for (auto i = 0u; i < Num_Latency_Buckets; ++i)
+					result.LatencyHistogram[i] = m_latencyHistogram[i];
+
+				return result;
+			}
+
+		public:
+			void update(size_t numEntities, uint64_t elapsedMillis) {
+				auto bucketIndex = 0u;
+				while (bucketIndex < Latency_Bucket_Bounds.size() && elapsedMillis >= Latency_Bucket_Bounds[bucketIndex])
+					++bucketIndex;
+
+				++m_latencyHistogram[bucketIndex];
+
+				// halve partitions that are too slow and grow full partitions that are much faster than the target
+				// (concurrent updates may race, in which case only one of them is applied)
+				size_t partitionSize = m_partitionSize;
+				auto newPartitionSize = partitionSize;
+				if (elapsedMillis > Target_Partition_Latency_Millis)
+					newPartitionSize = std::max(Min_Entities_Per_Partition, partitionSize / 2);
+				else if (numEntities >= partitionSize && elapsedMillis < Target_Partition_Latency_Millis / 4)
+					newPartitionSize = std::min(Max_Entities_Per_Partition, partitionSize + partitionSize / 4);
+
+				m_partitionSize.compare_exchange_strong(partitionSize, newPartitionSize);
+			}
+
+		private:
+			std::atomic<size_t> m_partitionSize;
+			std::array<std::atomic<uint64_t>, Num_Latency_Buckets> m_latencyHistogram;
+		};
+
 	private:
 		struct BulkWriteParams {
 		public:
@@ -61,8 +146,10 @@ namespace catapult { namespace mongo {
 
 		private:
 			static mongocxx::options::bulk_write GetBulkWriteOptions(const MongoBulkWriter& bulkWriter) {
+				// operations within a single bulk operation are independent, so let the server apply them in any order
 				mongocxx::options::bulk_write options;
 				options.write_concern(bulkWriter.writeOptions());
+				options.ordered(false);
 				return options;
 			}
 		};
@@ -92,6 +179,7 @@ namespace catapult { namespace mongo {
 				, m_writeTimeout(writeTimeout)
 				, m_pool(pool)
 				, m_connectionPool(uri)
+				, m_statisticsLogThrottle(Statistics_Log_Interval_Millis)
 		{}
 
 	public:
@@ -119,6 +207,11 @@ namespace catapult { namespace mongo {
 			return options;
 		}
 
+		/// Gets the bulk write statistics of the collection named \a collectionName.
+		CollectionStatistics statistics(const std::string& collectionName) {
+			return collectionWriteState(collectionName).statistics();
+		}
+
 	public:
 		/// Inserts \a entities into the collection named \a collectionName using a one-to-one mapping of entities
 		/// to documents (\a createDocument).
@@ -150,6 +243,15 @@ namespace catapult { namespace mongo {
 			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
 		}
 
+		/// Inserts already mapped \a documents into the collection named \a collectionName.
+		BulkWriteResultFuture bulkInsert(const std::string& collectionName, const std::vector<bsoncxx::document::value>& documents) {
+			auto appendOperation = [](auto& bulk, const auto& entityDocument, auto) {
+				bulk.append(mongocxx::model::insert_one(entityDocument.view()));
+			};
+
+			return bulkWrite<std::vector<bsoncxx::document::value>>(collectionName, documents, appendOperation);
+		}
+
 		/// Upserts \a entities into the collection named \a collectionName using a one-to-one mapping of entities
 		/// to documents (\a createDocument) matching the specified entity filter (\a createFilter).
 		template<typename TContainer>
@@ -169,6 +271,23 @@ namespace catapult { namespace mongo {
 			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
 		}
 
+		/// Updates \a entities in the collection named \a collectionName using a one-to-one mapping of entities
+		/// to update documents (\a createDocument) matching the specified entity filter (\a createFilter).
+		template<typename TContainer>
+		BulkWriteResultFuture bulkUpdate(
+				const std::string& collectionName,
+				const TContainer& entities,
+				const CreateDocument<typename TContainer::value_type>& createDocument,
+				const CreateFilter<typename TContainer::value_type>& createFilter) {
+			auto appendOperation = [createDocument, createFilter](auto& bulk, const auto& entity, auto index) {
+				auto updateDocument = createDocument(entity, index);
+				auto filter = createFilter(entity);
+				bulk.append(mongocxx::model::update_one(filter.view(), updateDocument.view()));
+			};
+
+			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
+		}
+
 		/// Deletes \a entities from the collection named \a collectionName matching the specified entity filter (\a createFilter).
 		template<typename TContainer>
 		BulkWriteResultFuture bulkDelete(
@@ -184,24 +303,42 @@ namespace catapult { namespace mongo {
 		}
 
 	private:
-		thread::future<BulkWriteResult> handleBulkOperation(
-				const std::string& collectionName,
-				std::shared_ptr<BulkWriteParams>&& pBulkWriteParams) {
-			// note: pBulkWriteParams depends on pThis (pBulkWriteParams.pConnection depends on pThis.m_connectionPool)
-			// it's crucial to move pBulkWriteParams into lambda, otherwise it would be copied while pThis would be moved
-			auto pPromise = std::make_shared<thread::promise<BulkWriteResult>>();
-			auto handler = [pThis = shared_from_this(), collectionName, pBulkWriteParams{std::move(pBulkWriteParams)}, pPromise]() {
-				pThis->bulkWrite(collectionName, *pBulkWriteParams, *pPromise);
-			};
+		CollectionWriteState& collectionWriteState(const std::string& collectionName) {
+			std::lock_guard<std::mutex> guard(m_collectionWriteStatesMutex);
+			auto& pState = m_collectionWriteStates[collectionName];
+			if (!pState)
+				pState = std::make_unique<CollectionWriteState>();
+
+			return *pState;
+		}
 
-			boost::asio::post(m_pool.ioContext(), handler);
-			return pPromise->get_future();
+		void logStatistics() {
+			if (m_statisticsLogThrottle.isThrottled())
+				return;
+
+			std::lock_guard<std::mutex> guard(m_collectionWriteStatesMutex);
+			for (const auto& pair : m_collectionWriteStates) {
+				auto statistics = pair.second->statistics();
+				CATAPULT_LOG(info)
+						<< "bulk '" << pair.first << "' statistics: partition size " << statistics.PartitionSize
+						<< ", latency histogram (<10ms, <100ms, <1s, >=1s) "
+						<< statistics.LatencyHistogram[0] << " " << statistics.LatencyHistogram[1] << " "
+						<< statistics.LatencyHistogram[2] << " " << statistics.LatencyHistogram[3];
+			}
 		}
 
-		void bulkWrite(const std::string& collectionName, BulkWriteParams& bulkWriteParams, thread::promise<BulkWriteResult>& promise) {
+		void bulkWrite(
+				const std::string& collectionName,
+				BulkWriteParams& bulkWriteParams,
+				size_t numEntities,
+				CollectionWriteState& writeState,
+				thread::promise<BulkWriteResult>& promise) {
 			try {
 				// if something goes wrong mongo will throw, else a result is always available
+				utils::StackTimer stopwatch;
 				auto result = bulkWriteParams.Bulk.execute().value();
+				writeState.update(numEntities, stopwatch.millis());
+				logStatistics();
 				promise.set_value(BulkWriteResult(result));
 			} catch (const mongocxx::bulk_write_exception& ex) {
 				std::ostringstream out;
@@ -248,24 +385,34 @@ namespace catapult { namespace mongo {
 			if (entities.empty())
 				return thread::make_ready_future(std::vector<thread::future<BulkWriteResult>>());
 
-			auto numThreads = m_pool.numWorkerThreads();
-			auto pContext = std::make_shared<BulkWriteContext>(std::min<size_t>(entities.size(), numThreads));
-			auto workCallback = [pThis = shared_from_this(), entitiesStart = entities.cbegin(), collectionName, appendOperation, pContext](
+			// split large writes into contiguous ranges (more partitions than threads) so that documents of later partitions are mapped
+			// while bulk operations of earlier partitions are being executed on their own pooled connections
+			auto& writeState = collectionWriteState(collectionName);
+			auto partitionSize = writeState.partitionSize();
+			auto numPartitions = std::max<size_t>(
+					std::min<size_t>(entities.size(), m_pool.numWorkerThreads()),
+					(entities.size() + partitionSize - 1) / partitionSize);
+			auto pContext = std::make_shared<BulkWriteContext>(numPartitions);
+			auto workCallback = [pThis = shared_from_this(), &writeState, collectionName, appendOperation, pContext](
 					auto itBegin,
 					auto itEnd,
 					auto startIndex,
 					auto batchIndex) {
-				auto pBulkWriteParams = std::make_shared<BulkWriteParams>(*pThis, collectionName);
+				BulkWriteParams bulkWriteParams(*pThis, collectionName);
 
 				auto index = static_cast<uint32_t>(startIndex);
 				for (auto iter = itBegin; itEnd != iter; ++iter, ++index)
-					appendOperation(pBulkWriteParams->Bulk, *iter, index);
+					appendOperation(bulkWriteParams.Bulk, *iter, index);
 
-				pContext->setFutureAt(batchIndex, pThis->handleBulkOperation(collectionName, std::move(pBulkWriteParams)));
+				// execute bulk operation on the mapping thread while other threads continue mapping remaining partitions
+				thread::promise<BulkWriteResult> promise;
+				pContext->setFutureAt(batchIndex, promise.get_future());
+				pThis->bulkWrite(collectionName, bulkWriteParams, index - static_cast<uint32_t>(startIndex), writeState, promise);
 			};
 
 			auto& ioContext = m_pool.ioContext();
-			return thread::compose(thread::ParallelForPartition(ioContext, entities, numThreads, workCallback), [pContext](const auto&) {
+			auto partitionFuture = thread::ParallelForPartition(ioContext, entities, numPartitions, workCallback);
+			return thread::compose(std::move(partitionFuture), [pContext](const auto&) {
 				return pContext->aggregateFuture();
 			});
 		}
@@ -275,5 +422,9 @@ namespace catapult { namespace mongo {
 		utils::TimeSpan m_writeTimeout;
 		thread::IoThreadPool& m_pool;
 		mongocxx::pool m_connectionPool;
+
+		std::unordered_map<std::string, std::unique_ptr<CollectionWriteState>> m_collectionWriteStates;
+		std::mutex m_collectionWriteStatesMutex;
+		utils::ThrottleLogger m_statisticsLogThrottle;
 	};
 }}
@@ -21,8 +21,11 @@
 
 #include "AccountStateMapper.h"
 #include "MapperUtils.h"
+#include "catapult/functions.h"
 #include "catapult/state/AccountState.h"
 #include "catapult/utils/Casting.h"
+#include <array>
+#include <cstring>
 
 namespace catapult { namespace mongo { namespace mappers {
 
@@ -156,4 +159,202 @@ namespace catapult { namespace mongo { namespace mappers {
 	}
 
 	// endregion
+
+	// region ToDbUpdate
+
+	namespace {
+		constexpr auto Account_Document_Name = "account";
+		constexpr auto Supplemental_Public_Keys_Document_Name = "supplementalPublicKeys";
+		constexpr std::array<const char*, 6> Header_Field_Names{ {
+			"version", "address", "addressHeight", "publicKey", "publicKeyHeight", "accountType"
+		} };
+		constexpr std::array<const char*, 4> Supplemental_Public_Key_Names{ { "linked", "node", "vrf", "voting" } };
+		constexpr std::array<const char*, 3> Array_Field_Names{ { "importances", "activityBuckets", "mosaics" } };
+
+		template<typename TElement, typename TAction>
+		void VisitValue(const TElement& element, TAction action) {
+			switch (element.type()) {
+			case bsoncxx::type::k_int32:
+				return action(element.get_int32());
+			case bsoncxx::type::k_int64:
+				return action(element.get_int64());
+			case bsoncxx::type::k_binary:
+				return action(element.get_binary());
+			case bsoncxx::type::k_document:
+				return action(element.get_document());
+			case bsoncxx::type::k_array:
+				return action(element.get_array());
+			default:
+				CATAPULT_THROW_INVALID_ARGUMENT_1("account state field has unsupported type", utils::to_underlying_type(element.type()));
+			}
+		}
+
+		// region AreEqual
+
+		bool AreBytesEqual(const uint8_t* pLhs, size_t lhsSize, const uint8_t* pRhs, size_t rhsSize) {
+			return lhsSize == rhsSize && (0 == lhsSize || 0 == std::memcmp(pLhs, pRhs, lhsSize));
+		}
+
+		template<typename TLhs, typename TRhs>
+		bool AreValuesEqual(const TLhs&, const TRhs&) {
+			// values of different types are never equal
+			return false;
+		}
+
+		bool AreValuesEqual(const bsoncxx::types::b_int32& lhs, const bsoncxx::types::b_int32& rhs) {
+			return lhs.value == rhs.value;
+		}
+
+		bool AreValuesEqual(const bsoncxx::types::b_int64& lhs, const bsoncxx::types::b_int64& rhs) {
+			return lhs.value == rhs.value;
+		}
+
+		bool AreValuesEqual(const bsoncxx::types::b_binary& lhs, const bsoncxx::types::b_binary& rhs) {
+			return lhs.sub_type == rhs.sub_type && AreBytesEqual(lhs.bytes, lhs.size, rhs.bytes, rhs.size);
+		}
+
+		bool AreValuesEqual(const bsoncxx::types::b_document& lhs, const bsoncxx::types::b_document& rhs) {
+			return AreBytesEqual(lhs.value.data(), lhs.value.length(), rhs.value.data(), rhs.value.length());
+		}
+
+		bool AreValuesEqual(const bsoncxx::types::b_array& lhs, const bsoncxx::types::b_array& rhs) {
+			return AreBytesEqual(lhs.value.data(), lhs.value.length(), rhs.value.data(), rhs.value.length());
+		}
+
+		template<typename TElement>
+		bool AreEqual(const TElement& lhs, const TElement& rhs) {
+			// absent elements are only equal to other absent elements
+			if (!lhs || !rhs)
+				return !lhs && !rhs;
+
+			auto areEqual = false;
+			VisitValue(lhs, [&rhs, &areEqual](const auto& lhsValue) {
+				VisitValue(rhs, [&lhsValue, &areEqual](const auto& rhsValue) {
+					areEqual = AreValuesEqual(lhsValue, rhsValue);
+				});
+			});
+			return areEqual;
+		}
+
+		// endregion
+
+		class UpdateFields {
+		private:
+			using SetField = consumer<bson_subdocument&>;
+
+		public:
+			template<typename TElement>
+			void set(const std::string& path, const TElement& element) {
+				m_setFields.push_back([path, element](auto& setDocument) {
+					VisitValue(element, [&setDocument, &path](const auto& value) {
+						setDocument << path << value;
+					});
+				});
+			}
+
+			void unset(const std::string& path) {
+				m_unsetPaths.push_back(path);
+			}
+
+			bsoncxx::document::value toDocument() const {
+				bson_stream::document builder;
+				if (!m_setFields.empty()) {
+					auto setDocument = builder << "$set" << bson_stream::open_document;
+					for (const auto& setField : m_setFields)
+						setField(setDocument);
+
+					setDocument << bson_stream::close_document;
+				}
+
+				if (!m_unsetPaths.empty()) {
+					auto unsetDocument = builder << "$unset" << bson_stream::open_document;
+					for (const auto& path : m_unsetPaths)
+						unsetDocument << path << "";
+
+					unsetDocument << bson_stream::close_document;
+				}
+
+				return builder << bson_stream::finalize;
+			}
+
+		private:
+			std::vector<SetField> m_setFields;
+			std::vector<std::string> m_unsetPaths;
+		};
+
+		std::string MakePath(const std::string& parentPath, const std::string& name) {
+			return parentPath + "." + name;
+		}
+
+		void AddArrayUpdates(
+				UpdateFields& updateFields,
+				const std::string& path,
+				const bsoncxx::document::element& arrayElement,
+				const bsoncxx::document::element& previousArrayElement) {
+			if (AreEqual(arrayElement, previousArrayElement))
+				return;
+
+			auto arrayView = arrayElement.get_array().value;
+			auto previousArrayView = previousArrayElement.get_array().value;
+			std::vector<bsoncxx::array::element> elements(arrayView.begin(), arrayView.end());
+			std::vector<bsoncxx::array::element> previousElements(previousArrayView.begin(), previousArrayView.end());
+			if (elements.size() != previousElements.size()) {
+				updateFields.set(path, arrayElement);
+				return;
+			}
+
+			std::vector<uint32_t> changedIndexes;
+			for (auto i = 0u; i < elements.size(); ++i) {
+				if (!AreEqual(elements[i], previousElements[i]))
+					changedIndexes.push_back(i);
+			}
+
+			// replace the whole array when all elements changed (e.g. shifted importances) to minimize update size
+			if (changedIndexes.size() == elements.size()) {
+				updateFields.set(path, arrayElement);
+				return;
+			}
+
+			for (auto index : changedIndexes)
+				updateFields.set(MakePath(path, std::to_string(index)), elements[index]);
+		}
+	}
+
+	bsoncxx::document::value ToDbUpdate(
+			const bsoncxx::document::view& dbAccountState,
+			const bsoncxx::document::view& previousDbAccountState) {
+		UpdateFields updateFields;
+		if (AreBytesEqual(dbAccountState.data(), dbAccountState.length(), previousDbAccountState.data(), previousDbAccountState.length()))
+			return updateFields.toDocument();
+
+		auto accountView = dbAccountState[Account_Document_Name].get_document().view();
+		auto previousAccountView = previousDbAccountState[Account_Document_Name].get_document().view();
+
+		for (const auto* name : Header_Field_Names) {
+			if (!AreEqual(accountView[name], previousAccountView[name]))
+				updateFields.set(MakePath(Account_Document_Name, name), accountView[name]);
+		}
+
+		auto supplementalPublicKeysPath = MakePath(Account_Document_Name, Supplemental_Public_Keys_Document_Name);
+		auto supplementalPublicKeysView = accountView[Supplemental_Public_Keys_Document_Name].get_document().view();
+		auto previousSupplementalPublicKeysView = previousAccountView[Supplemental_Public_Keys_Document_Name].get_document().view();
+		for (const auto* name : Supplemental_Public_Key_Names) {
+			auto keyElement = supplementalPublicKeysView[name];
+			if (AreEqual(keyElement, previousSupplementalPublicKeysView[name]))
+				continue;
+
+			auto path = MakePath(supplementalPublicKeysPath, name);
+			if (!keyElement)
+				updateFields.unset(path);
+			else
+				updateFields.set(path, keyElement);
+		}
+
+		for (const auto* name : Array_Field_Names)
+			AddArrayUpdates(updateFields, MakePath(Account_Document_Name, name), accountView[name], previousAccountView[name]);
+
+		return updateFields.toDocument();
+	}
+
+	// endregion
 }}}
@@ -28,4 +28,11 @@ namespace catapult { namespace mongo { namespace mappers {
 
 	/// Maps an account state (\a accountState) to the corresponding db model value.
 	bsoncxx::document::value ToDbModel(const state::AccountState& accountState);
+
+	/// Maps all fields of an account state db model (\a dbAccountState) that differ from the previously written
+	/// account state db model (\a previousDbAccountState) to a db update document composed of \c $set and \c $unset operations.
+	/// \note Fields are compared by value and an empty document is returned when no fields differ.
+	bsoncxx::document::value ToDbUpdate(
+			const bsoncxx::document::view& dbAccountState,
+			const bsoncxx::document::view& previousDbAccountState);
 }}}
@@ -23,34 +23,204 @@
 #include "mongo/src/mappers/AccountStateMapper.h"
 #include "mongo/src/storages/MongoCacheStorage.h"
 #include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/utils/Hashers.h"
+#include <deque>
 
 using namespace bsoncxx::builder::stream;
 
 namespace catapult { namespace mongo { namespace storages {
 
 	namespace {
+		constexpr auto Collection_Name = "accounts";
+		constexpr auto Id_Property_Name = "account.address";
+
+		// maximum number of previously written account documents retained for computing differential updates
+		constexpr size_t Max_Account_Documents = 100'000;
+
 		struct AccountStateCacheTraits {
-			using CacheType = cache::AccountStateCache;
-			using CacheDeltaType = cache::AccountStateCacheDelta;
 			using KeyType = Address;
-			using ModelType = state::AccountState;
-
-			static constexpr auto Collection_Name = "accounts";
-			static constexpr auto Id_Property_Name = "account.address";
 
-			static auto GetId(const ModelType& accountState) {
+			static auto GetId(const state::AccountState& accountState) {
 				return accountState.Address;
 			}
+		};
+
+		// region WrittenAccountDocuments
+
+		class WrittenAccountDocuments {
+		public:
+			explicit WrittenAccountDocuments(size_t maxSize) : m_maxSize(maxSize)
+			{}
+
+		public:
+			const bsoncxx::document::value* find(const Address& address) const {
+				auto iter = m_documents.find(address);
+				return m_documents.cend() == iter ? nullptr : &iter->second;
+			}
+
+			void set(const Address& address, bsoncxx::document::value&& document) {
+				auto iter = m_documents.find(address);
+				if (m_documents.cend() != iter) {
+					iter->second = std::move(document);
+					return;
+				}
+
+				m_documents.emplace(address, std::move(document));
+				m_insertionOrder.push_back(address);
+
+				// evict oldest documents first; evicted accounts are fully replaced on their next write
+				while (m_insertionOrder.size() > m_maxSize) {
+					m_documents.erase(m_insertionOrder.front());
+					m_insertionOrder.pop_front();
+				}
+			}
+
+			void remove(const Address& address) {
+				m_documents.erase(address);
+			}
+
+			void clear() {
+				m_documents.clear();
+				m_insertionOrder.clear();
+			}
+
+		private:
+			size_t m_maxSize;
+			std::unordered_map<Address, bsoncxx::document::value, utils::ArrayHasher<Address>> m_documents;
+			std::deque<Address> m_insertionOrder;
+		};
+
+		// endregion
+
+		// region MongoAccountStateCacheStorage
+
+		class MongoAccountStateCacheStorage : public ExternalCacheStorageT<cache::AccountStateCache> {
+		private:
+			using CacheChangesType = cache::SingleCacheChangesT<cache::AccountStateCacheDelta, state::AccountState>;
+			using ElementContainerType = std::unordered_set<const state::AccountState*>;
+			using BulkWriteResultFuture = thread::future<std::vector<thread::future<BulkWriteResult>>>;
+
+			struct AccountDocument {
+				catapult::Address Address;
+				bsoncxx::document::value DbAccountState;
+				bsoncxx::document::value DbUpdate;
+			};
+
+		public:
+			MongoAccountStateCacheStorage(MongoStorageContext& storageContext, model::NetworkIdentifier)
+					: m_errorPolicy(storageContext.createCollectionErrorPolicy(Collection_Name))
+					, m_bulkWriter(storageContext.bulkWriter())
+					, m_writtenDocuments(Max_Account_Documents)
+			{}
+
+		private:
+			void saveDelta(const CacheChangesType& changes) override {
+				auto addedElements = changes.addedElements();
+				auto modifiedElements = changes.modifiedElements();
+				auto removedElements = changes.removedElements();
+
+				// 1. remove elements common to both added and removed
+				detail::MongoElementFilter<AccountStateCacheTraits, ElementContainerType>::RemoveCommonElements(
+						addedElements,
+						removedElements);
+
+				try {
+					// 2. remove all removed elements from db
+					removeAll(removedElements);
+
+					// 3. update modified elements and upsert new elements into db
+					modifiedElements.insert(addedElements.cbegin(), addedElements.cend());
+					upsertAll(modifiedElements);
+				} catch (...) {
+					// db contents are unknown after a failure, so all subsequent writes must replace full documents
+					m_writtenDocuments.clear();
+					throw;
+				}
+			}
+
+		private:
+			void removeAll(const ElementContainerType& elements) {
+				if (elements.empty())
+					return;
+
+				auto createFilter = [](const auto* pAccountState) {
+					return CreateFilter(pAccountState->Address);
+				};
+				auto deleteResults = m_bulkWriter.bulkDelete(Collection_Name, elements, createFilter).get();
+				auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(deleteResults)));
+				m_errorPolicy.checkDeleted(elements.size(), aggregateResult, "removed elements");
+
+				for (const auto* pAccountState : elements)
+					m_writtenDocuments.remove(pAccountState->Address);
+			}
+
+			void upsertAll(const ElementContainerType& elements) {
+				if (elements.empty())
+					return;
 
-			static auto MapToMongoId(const Address& address) {
-				return mappers::ToBinary(address);
+				// full documents are written for accounts without known written documents and field-level updates for all others
+				std::vector<AccountDocument> replacements;
+				std::vector<AccountDocument> updates;
+				for (const auto* pAccountState : elements) {
+					auto dbAccountState = mappers::ToDbModel(*pAccountState);
+
+					const auto* pPreviousDbAccountState = m_writtenDocuments.find(pAccountState->Address);
+					if (!pPreviousDbAccountState) {
+						replacements.push_back({ pAccountState->Address, std::move(dbAccountState), document() << finalize });
+						continue;
+					}
+
+					auto dbUpdate = mappers::ToDbUpdate(dbAccountState.view(), pPreviousDbAccountState->view());
+					if (dbUpdate.view().empty())
+						continue;
+
+					updates.push_back({ pAccountState->Address, std::move(dbAccountState), std::move(dbUpdate) });
+				}
+
+				auto createReplacementDocument = [](const auto& accountDocument, auto) {
+					return accountDocument.DbAccountState;
+				};
+				auto createUpdateDocument = [](const auto& accountDocument, auto) {
+					return accountDocument.DbUpdate;
+				};
+				auto createFilter = [](const auto& accountDocument) {
+					return CreateFilter(accountDocument.Address);
+				};
+
+				std::vector<BulkWriteResultFuture> futures;
+				futures.push_back(m_bulkWriter.bulkUpsert(Collection_Name, replacements, createReplacementDocument, createFilter));
+				futures.push_back(m_bulkWriter.bulkUpdate(Collection_Name, updates, createUpdateDocument, createFilter));
+
+				std::vector<BulkWriteResult> results;
+				for (auto& resultsFuture : thread::when_all(std::move(futures)).get()) {
+					auto partialResults = thread::get_all(resultsFuture.get());
+					results.insert(results.end(), partialResults.cbegin(), partialResults.cend());
+				}
+
+				auto aggregateResult = BulkWriteResult::Aggregate(results);
+				m_errorPolicy.checkUpserted(replacements.size() + updates.size(), aggregateResult, "modified and added elements");
+
+				for (auto* pAccountDocuments : { &replacements, &updates }) {
+					for (auto& accountDocument : *pAccountDocuments)
+						m_writtenDocuments.set(accountDocument.Address, std::move(accountDocument.DbAccountState));
+				}
 			}
 
-			static auto MapToMongoDocument(const state::AccountState& accountState, model::NetworkIdentifier) {
-				return mappers::ToDbModel(accountState);
+		private:
+			static bsoncxx::document::value CreateFilter(const Address& address) {
+				return document() << Id_Property_Name << mappers::ToBinary(address) << finalize;
 			}
+
+		private:
+			MongoErrorPolicy m_errorPolicy;
+			MongoBulkWriter& m_bulkWriter;
+			WrittenAccountDocuments m_writtenDocuments;
 		};
+
+		// endregion
 	}
 
-	DEFINE_MONGO_FLAT_CACHE_STORAGE(AccountState, AccountStateCacheTraits)
+	DECLARE_MONGO_CACHE_STORAGE(AccountState) {
+		return std::make_unique<MongoAccountStateCacheStorage>(storageContext, networkIdentifier);
+	}
 }}}
@@ -40,7 +40,9 @@ namespace catapult { namespace mongo {
 							{ "databaseName", "foo" },
 							{ "maxWriterThreads", "3" },
 							{ "maxDropBatchSize", "7" },
-							{ "writeTimeout", "22s" }
+							{ "writeTimeout", "22s" },
+							{ "maxWriteBatchBlocks", "15" },
+							{ "maxWriteBatchDelay", "250ms" }
 						}
 					},
 					{
@@ -65,6 +67,8 @@ namespace catapult { namespace mongo {
 				EXPECT_EQ(0u, config.MaxWriterThreads);
 				EXPECT_EQ(0u, config.MaxDropBatchSize);
 				EXPECT_EQ(utils::TimeSpan(), config.WriteTimeout);
+				EXPECT_EQ(0u, config.MaxWriteBatchBlocks);
+				EXPECT_EQ(utils::TimeSpan(), config.MaxWriteBatchDelay);
 				EXPECT_EQ(std::unordered_set<std::string>(), config.Plugins);
 			}
 
@@ -75,6 +79,8 @@ namespace catapult { namespace mongo {
 				EXPECT_EQ(3u, config.MaxWriterThreads);
 				EXPECT_EQ(7u, config.MaxDropBatchSize);
 				EXPECT_EQ(utils::TimeSpan::FromSeconds(22), config.WriteTimeout);
+				EXPECT_EQ(15u, config.MaxWriteBatchBlocks);
+				EXPECT_EQ(utils::TimeSpan::FromMilliseconds(250), config.MaxWriteBatchDelay);
 				EXPECT_EQ(std::unordered_set<std::string>({ "Alpha", "gamma" }), config.Plugins);
 			}
 		};
@@ -99,6 +105,8 @@ namespace catapult { namespace mongo {
 		EXPECT_EQ(8u, config.MaxWriterThreads);
 		EXPECT_EQ(100u, config.MaxDropBatchSize);
 		EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.WriteTimeout);
+		EXPECT_EQ(100u, config.MaxWriteBatchBlocks);
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(500), config.MaxWriteBatchDelay);
 		EXPECT_FALSE(config.Plugins.empty());
 	}
 
@@ -70,19 +70,27 @@ namespace catapult { namespace mongo {
 			}
 		};
 
-		std::shared_ptr<io::LightBlockStorage> CreateMongoBlockStorage(
+		std::shared_ptr<MongoBlockStorage> CreateMongoBlockStorage(
 				std::unique_ptr<MongoTransactionPlugin>&& pTransactionPlugin,
-				MongoErrorPolicy::Mode errorPolicyMode = MongoErrorPolicy::Mode::Strict) {
+				MongoErrorPolicy::Mode errorPolicyMode = MongoErrorPolicy::Mode::Strict,
+				uint32_t maxWriteBatchBlocks = 1,
+				const utils::TimeSpan& maxWriteBatchDelay = utils::TimeSpan()) {
 			auto pMongoReceiptRegistry = std::make_shared<MongoReceiptRegistry>();
 			auto mockReceiptType = utils::to_underlying_type(mocks::MockReceipt::Receipt_Type);
 			pMongoReceiptRegistry->registerPlugin(mocks::CreateMockReceiptMongoPlugin(mockReceiptType));
 			const auto& receiptRegistry = *pMongoReceiptRegistry;
-			auto pBlockStorage = test::CreateMongoStorage<io::LightBlockStorage>(
+			auto pBlockStorage = test::CreateMongoStorage<MongoBlockStorage>(
 					std::move(pTransactionPlugin),
 					test::DbInitializationType::None,
 					errorPolicyMode,
-					[&receiptRegistry](auto& context, const auto& transactionRegistry) {
-						return mongo::CreateMongoBlockStorage(context, Max_Drop_Batch_Size, transactionRegistry, receiptRegistry);
+					[maxWriteBatchBlocks, maxWriteBatchDelay, &receiptRegistry](auto& context, const auto& transactionRegistry) {
+						return mongo::CreateMongoBlockStorage(
+								context,
+								Max_Drop_Batch_Size,
+								maxWriteBatchBlocks,
+								maxWriteBatchDelay,
+								transactionRegistry,
+								receiptRegistry);
 					});
 
 			return decltype(pBlockStorage)(pBlockStorage.get(), [pMongoReceiptRegistry, pBlockStorage](const auto*) {});
@@ -337,7 +345,24 @@ namespace catapult { namespace mongo {
 		class TestContext final : public test::PrepareDatabaseMixin {
 		public:
 			explicit TestContext(size_t topHeight, MongoErrorPolicy::Mode errorPolicyMode = MongoErrorPolicy::Mode::Strict)
-					: m_pStorage(CreateMongoBlockStorage(mocks::CreateMockTransactionMongoPlugin(), errorPolicyMode)) {
+					: TestContext(topHeight, errorPolicyMode, 1, utils::TimeSpan())
+			{}
+
+			TestContext(size_t topHeight, uint32_t maxWriteBatchBlocks, const utils::TimeSpan& maxWriteBatchDelay)
+					: TestContext(topHeight, MongoErrorPolicy::Mode::Strict, maxWriteBatchBlocks, maxWriteBatchDelay)
+			{}
+
+		private:
+			TestContext(
+					size_t topHeight,
+					MongoErrorPolicy::Mode errorPolicyMode,
+					uint32_t maxWriteBatchBlocks,
+					const utils::TimeSpan& maxWriteBatchDelay)
+					: m_pStorage(CreateMongoBlockStorage(
+							mocks::CreateMockTransactionMongoPlugin(),
+							errorPolicyMode,
+							maxWriteBatchBlocks,
+							maxWriteBatchDelay)) {
 				for (auto i = 1u; i <= topHeight; ++i) {
 					auto transactions = test::GenerateRandomTransactions(Default_Transactions_Per_Block);
 					m_blocks.push_back(test::GenerateBlockWithTransactions(transactions));
@@ -349,13 +374,17 @@ namespace catapult { namespace mongo {
 			}
 
 		public:
-			io::LightBlockStorage& storage() {
+			MongoBlockStorage& storage() {
 				return *m_pStorage;
 			}
 
 			void saveBlocks() {
-				for (const auto& blockElement : m_blockElements)
-					storage().saveBlock(blockElement);
+				saveBlocks(m_blockElements.size());
+			}
+
+			void saveBlocks(size_t count) {
+				for (auto i = 0u; i < count; ++i)
+					storage().saveBlock(m_blockElements[i]);
 			}
 
 			const std::vector<model::BlockElement>& elements() {
@@ -365,7 +394,7 @@ namespace catapult { namespace mongo {
 		private:
 			std::vector<std::unique_ptr<model::Block>> m_blocks;
 			std::vector<model::BlockElement> m_blockElements;
-			std::shared_ptr<io::LightBlockStorage> m_pStorage;
+			std::shared_ptr<MongoBlockStorage> m_pStorage;
 		};
 
 		// endregion
@@ -553,7 +582,7 @@ namespace catapult { namespace mongo {
 		EXPECT_EQ(98u, test::GetUint64(currentView, "scoreLow"));
 	}
 
-	TEST(TEST_CLASS, CannotSaveSameBlockTwiceWhenErrorModeIsStrict) {
+	TEST(TEST_CLASS, SaveBlockIgnoresSavedBlockWhenErrorModeIsStrict) {
 		// Arrange:
 		auto pTransactionPlugin = mocks::CreateMockTransactionMongoPlugin(mocks::PluginOptionFlags::Default, 0);
 		auto pStorage = CreateMongoBlockStorage(std::move(pTransactionPlugin));
@@ -562,8 +591,20 @@ namespace catapult { namespace mongo {
 		auto blockElement = test::BlockToBlockElement(*pBlock, test::GenerateRandomByteArray<Hash256>());
 		pStorage->saveBlock(blockElement);
 
-		// Act + Assert:
-		EXPECT_THROW(pStorage->saveBlock(blockElement), catapult_invalid_argument);
+		// Act:
+		pStorage->saveBlock(blockElement);
+
+		// Assert:
+		ASSERT_EQ(Height(1), pStorage->chainHeight());
+
+		AssertEqual(blockElement, 3);
+
+		// - check collection sizes
+		auto connection = test::CreateDbConnection();
+		auto database = connection[test::DatabaseName()];
+		auto filter = document() << finalize;
+		EXPECT_EQ(1u, database["blocks"].count_documents(filter.view()));
+		EXPECT_EQ(3u, static_cast<size_t>(database["transactions"].count_documents(filter.view())));
 	}
 
 	TEST(TEST_CLASS, CanSaveSameBlockTwiceWhenErrorModeIsIdempotent) {
@@ -682,6 +723,146 @@ namespace catapult { namespace mongo {
 
 	// endregion
 
+	// region saveBlock (batched)
+
+	namespace {
+		constexpr auto Max_Write_Batch_Blocks = 4u;
+
+		void AssertSavedBlocks(const std::vector<model::BlockElement>& blockElements, Height height) {
+			auto connection = test::CreateDbConnection();
+			auto database = connection[test::DatabaseName()];
+			auto filter = document() << finalize;
+			EXPECT_EQ(height.unwrap(), static_cast<uint64_t>(database["blocks"].count_documents(filter.view())));
+
+			BlockElementCounts blockElementCounts;
+			for (const auto& blockElement : blockElements) {
+				if (blockElement.Block.Height > height)
+					continue;
+
+				AssertEqual(blockElement, Default_Transactions_Per_Block);
+				blockElementCounts.AddCounts(blockElement);
+			}
+
+			AssertCollectionSizes(blockElementCounts);
+		}
+	}
+
+	TEST(TEST_CLASS, SaveBlockDoesNotWriteBlocksUntilBatchIsFull) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count, Max_Write_Batch_Blocks, utils::TimeSpan::FromHours(1));
+
+		// Act:
+		context.saveBlocks(Max_Write_Batch_Blocks - 1);
+
+		// Assert:
+		EXPECT_EQ(Height(), context.storage().chainHeight());
+		AssertSavedBlocks(context.elements(), Height());
+	}
+
+	TEST(TEST_CLASS, SaveBlockWritesBlocksWhenBatchIsFull) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count, Max_Write_Batch_Blocks, utils::TimeSpan::FromHours(1));
+
+		// Act:
+		context.saveBlocks(Max_Write_Batch_Blocks);
+
+		// Assert:
+		EXPECT_EQ(Height(Max_Write_Batch_Blocks), context.storage().chainHeight());
+		AssertSavedBlocks(context.elements(), Height(Max_Write_Batch_Blocks));
+	}
+
+	TEST(TEST_CLASS, SaveBlockWritesBlocksWhenBatchDelayIsExceeded) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count, Max_Write_Batch_Blocks, utils::TimeSpan());
+
+		// Act:
+		context.saveBlocks(Max_Write_Batch_Blocks - 1);
+
+		// Assert:
+		EXPECT_EQ(Height(Max_Write_Batch_Blocks - 1), context.storage().chainHeight());
+		AssertSavedBlocks(context.elements(), Height(Max_Write_Batch_Blocks - 1));
+	}
+
+	TEST(TEST_CLASS, FlushWritesPendingBlocks) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count, Max_Write_Batch_Blocks, utils::TimeSpan::FromHours(1));
+		context.saveBlocks();
+
+		// Sanity: only full batches have been written
+		EXPECT_EQ(Height(2 * Max_Write_Batch_Blocks), context.storage().chainHeight());
+
+		// Act:
+		context.storage().flush();
+
+		// Assert:
+		EXPECT_EQ(Height(Multiple_Blocks_Count), context.storage().chainHeight());
+		AssertSavedBlocks(context.elements(), Height(Multiple_Blocks_Count));
+	}
+
+	TEST(TEST_CLASS, CannotSaveBlockAtPendingHeight) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count, Max_Write_Batch_Blocks, utils::TimeSpan::FromHours(1));
+		context.saveBlocks(2);
+
+		// Act + Assert:
+		EXPECT_THROW(context.storage().saveBlock(context.elements()[1]), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanReplayPartiallyWrittenBatch) {
+		// Arrange: write first batch and leave following blocks pending, as when a broker batch fails after an automatic write
+		TestContext context(Multiple_Blocks_Count, Max_Write_Batch_Blocks, utils::TimeSpan::FromHours(1));
+		context.saveBlocks(Max_Write_Batch_Blocks + 2);
+
+		// Sanity:
+		EXPECT_EQ(Height(Max_Write_Batch_Blocks), context.storage().chainHeight());
+
+		// - pending blocks are lost on restart
+		auto pStorage = CreateMongoBlockStorage(
+				mocks::CreateMockTransactionMongoPlugin(),
+				MongoErrorPolicy::Mode::Strict,
+				Max_Write_Batch_Blocks,
+				utils::TimeSpan::FromHours(1));
+
+		// Act: replay all blocks, including the written ones
+		for (const auto& blockElement : context.elements())
+			pStorage->saveBlock(blockElement);
+
+		pStorage->flush();
+
+		// Assert: all blocks were written exactly once
+		EXPECT_EQ(Height(Multiple_Blocks_Count), pStorage->chainHeight());
+		AssertSavedBlocks(context.elements(), Height(Multiple_Blocks_Count));
+	}
+
+	TEST(TEST_CLASS, SaveBlockIgnoresSavedBlockWhenBlocksArePending) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count, Max_Write_Batch_Blocks, utils::TimeSpan::FromHours(1));
+		context.saveBlocks(Max_Write_Batch_Blocks + 2);
+
+		// Act:
+		context.storage().saveBlock(context.elements()[1]);
+		context.storage().flush();
+
+		// Assert:
+		EXPECT_EQ(Height(Max_Write_Batch_Blocks + 2), context.storage().chainHeight());
+		AssertSavedBlocks(context.elements(), Height(Max_Write_Batch_Blocks + 2));
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterWritesPendingBlocksBeforeDropping) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count, Max_Write_Batch_Blocks, utils::TimeSpan::FromHours(1));
+		context.saveBlocks(Max_Write_Batch_Blocks - 1);
+
+		// Act:
+		context.storage().dropBlocksAfter(Height(1));
+
+		// Assert:
+		EXPECT_EQ(Height(1), context.storage().chainHeight());
+		AssertSavedBlocks(context.elements(), Height(1));
+	}
+
+	// endregion
+
 	// region dropBlocksAfter
 
 	namespace {
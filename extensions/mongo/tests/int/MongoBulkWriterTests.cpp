@@ -35,6 +35,7 @@
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/TestHarness.h"
 #include <mongocxx/pool.hpp>
+#include <numeric>
 
 using namespace bsoncxx::builder::stream;
 
@@ -630,6 +631,76 @@ namespace catapult { namespace mongo {
 
 	// endregion
 
+	// region many entities
+
+	TEST(TEST_CLASS, BulkOperationCanProcessMorePartitionsThanThreads) {
+		// Arrange: use enough entities to require more partitions than threads
+		constexpr auto Num_Entities = 500u * test::Num_Default_Mongo_Test_Pool_Threads + 123;
+		PerformanceContext context(Num_Entities);
+		auto registry = test::CreateDefaultMongoTransactionRegistry();
+		auto createDocument = [&registry](const auto& transactionElement, auto index) {
+			return CreateDocument(transactionElement, Height(1), index, registry);
+		};
+
+		// Act:
+		auto results = context.bulkWriter().bulkInsert<TransactionElements>(
+				Transactions_Collection_Name,
+				context.transactionElements(),
+				createDocument).get();
+
+		// Assert:
+		auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(results)));
+		test::AssertCollectionSize(Transactions_Collection_Name, Num_Entities);
+		AssertResult(static_cast<int32_t>(Num_Entities), 0, 0, 0, 0, aggregateResult);
+	}
+
+	// endregion
+
+	// region statistics
+
+	TEST(TEST_CLASS, StatisticsAreInitiallyDefault) {
+		// Arrange:
+		PerformanceContext context(1);
+
+		// Act:
+		auto statistics = context.bulkWriter().statistics(Transactions_Collection_Name);
+
+		// Assert:
+		EXPECT_EQ(MongoBulkWriter::Initial_Entities_Per_Partition, statistics.PartitionSize);
+		for (auto count : statistics.LatencyHistogram)
+			EXPECT_EQ(0u, count);
+	}
+
+	TEST(TEST_CLASS, BulkOperationUpdatesCollectionStatistics) {
+		// Arrange: use enough entities to require more partitions than threads
+		constexpr auto Num_Entities = 500u * test::Num_Default_Mongo_Test_Pool_Threads + 123;
+		PerformanceContext context(Num_Entities);
+		auto registry = test::CreateDefaultMongoTransactionRegistry();
+		auto createDocument = [&registry](const auto& transactionElement, auto index) {
+			return CreateDocument(transactionElement, Height(1), index, registry);
+		};
+
+		// Act:
+		auto results = context.bulkWriter().bulkInsert<TransactionElements>(
+				Transactions_Collection_Name,
+				context.transactionElements(),
+				createDocument).get();
+		auto numPartitions = results.size();
+		thread::get_all(std::move(results));
+
+		// Assert: every partition was recorded in the histogram of the written collection only
+		auto statistics = context.bulkWriter().statistics(Transactions_Collection_Name);
+		EXPECT_LE(MongoBulkWriter::Min_Entities_Per_Partition, statistics.PartitionSize);
+		EXPECT_GE(MongoBulkWriter::Max_Entities_Per_Partition, statistics.PartitionSize);
+		EXPECT_EQ(numPartitions, std::accumulate(statistics.LatencyHistogram.cbegin(), statistics.LatencyHistogram.cend(), uint64_t()));
+
+		auto otherStatistics = context.bulkWriter().statistics(Accounts_Collection_Name);
+		for (auto count : otherStatistics.LatencyHistogram)
+			EXPECT_EQ(0u, count);
+	}
+
+	// endregion
+
 	// region bulk writer exception
 
 	TEST(TEST_CLASS, FutureExposesBulkWriteExceptions) {
@@ -25,6 +25,7 @@
 #include "catapult/model/Address.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "mongo/tests/test/MapperTestUtils.h"
+#include "mongo/tests/test/MongoCacheStorageTestUtils.h"
 #include "mongo/tests/test/MongoFlatCacheStorageTests.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/AccountStateTestUtils.h"
@@ -108,4 +109,78 @@ namespace catapult { namespace mongo { namespace storages {
 	}
 
 	DEFINE_FLAT_CACHE_STORAGE_TESTS(AccountStateCacheTraits,)
+
+	// region differential updates
+
+	namespace {
+		class TestContext : public test::MongoCacheStorageTestUtils<AccountStateCacheTraits> {
+		public:
+			using BaseType = test::MongoCacheStorageTestUtils<AccountStateCacheTraits>;
+			using BaseType::AssertDbContents;
+
+		public:
+			TestContext() : m_cache(AccountStateCacheTraits::CreateCache())
+			{}
+
+		public:
+			void saveAndCommit(const consumer<cache::CatapultCacheDelta&>& modifyDelta) {
+				auto delta = m_cache.createDelta();
+				modifyDelta(delta);
+				m_storage.get().saveDelta(cache::CacheChanges(delta));
+				m_cache.commit(Height());
+			}
+
+		private:
+			BaseType::CacheStorageWrapper m_storage;
+			cache::CatapultCache m_cache;
+		};
+	}
+
+	TEST(TEST_CLASS, ElementModifiedMultipleTimesIsSavedToStorage) {
+		// Arrange:
+		TestContext context;
+		auto element = AccountStateCacheTraits::GenerateRandomElement(11);
+		context.saveAndCommit([&element](auto& delta) { AccountStateCacheTraits::Add(delta, element); });
+
+		// Act: subsequent modifications are saved as field-level updates
+		for (auto i = 0u; i < 3; ++i)
+			context.saveAndCommit([&element](auto& delta) { AccountStateCacheTraits::Mutate(delta, element); });
+
+		// Assert:
+		context.AssertDbContents({ element });
+	}
+
+	TEST(TEST_CLASS, ElementWithAddedMosaicIsSavedToStorage) {
+		// Arrange:
+		TestContext context;
+		auto element = AccountStateCacheTraits::GenerateRandomElement(11);
+		context.saveAndCommit([&element](auto& delta) { AccountStateCacheTraits::Add(delta, element); });
+
+		// Act:
+		context.saveAndCommit([&element](auto& delta) {
+			element.Balances.credit(MosaicId(2468), Amount(777));
+
+			auto& accountStateCacheDelta = delta.template sub<cache::AccountStateCache>();
+			accountStateCacheDelta.find(element.PublicKey).get().Balances.credit(MosaicId(2468), Amount(777));
+		});
+
+		// Assert:
+		context.AssertDbContents({ element });
+	}
+
+	TEST(TEST_CLASS, ElementReaddedAfterRemovalIsSavedToStorage) {
+		// Arrange:
+		TestContext context;
+		auto element = AccountStateCacheTraits::GenerateRandomElement(11);
+		context.saveAndCommit([&element](auto& delta) { AccountStateCacheTraits::Add(delta, element); });
+		context.saveAndCommit([&element](auto& delta) { AccountStateCacheTraits::Remove(delta, element); });
+
+		// Act:
+		context.saveAndCommit([&element](auto& delta) { AccountStateCacheTraits::Add(delta, element); });
+
+		// Assert:
+		context.AssertDbContents({ element });
+	}
+
+	// endregion
 }}}
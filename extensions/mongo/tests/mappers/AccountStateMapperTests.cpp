@@ -250,4 +250,184 @@ namespace catapult { namespace mongo { namespace mappers {
 	}
 
 	// endregion
+
+	// region ToDbUpdate
+
+	namespace {
+		state::AccountState CreateAccountStateWithMosaics() {
+			RandomSeed seed;
+			seed.SupplementalPublicKeysMask = state::AccountPublicKeys::KeyType::Linked;
+			return CreateAccountState(
+					Height(456),
+					{ { MosaicId(1234), Amount(234) }, { MosaicId(1357), Amount(345) }, { MosaicId(31), Amount(45) } },
+					seed);
+		}
+
+		auto CalculateUpdate(const state::AccountState& previousAccountState, const state::AccountState& accountState) {
+			auto previousDbAccount = ToDbModel(previousAccountState);
+			auto dbAccount = ToDbModel(accountState);
+			return ToDbUpdate(dbAccount.view(), previousDbAccount.view());
+		}
+
+		auto GetAccountView(const bsoncxx::document::value& dbAccount) {
+			return dbAccount.view()["account"].get_document().view();
+		}
+	}
+
+	TEST(TEST_CLASS, ToDbUpdateIsEmptyWhenNoFieldsChanged) {
+		// Arrange:
+		auto accountState = CreateAccountStateWithMosaics();
+
+		// Act:
+		auto dbUpdate = CalculateUpdate(accountState, accountState);
+
+		// Assert:
+		EXPECT_TRUE(dbUpdate.view().empty());
+	}
+
+	TEST(TEST_CLASS, ToDbUpdateSetsOnlyChangedMosaicWhenBalanceChanges) {
+		// Arrange:
+		auto previousAccountState = CreateAccountStateWithMosaics();
+		auto accountState = previousAccountState;
+		accountState.Balances.credit(MosaicId(1357), Amount(100));
+
+		// - find the index of the changed mosaic
+		auto dbAccount = ToDbModel(accountState);
+		auto mosaicsView = GetAccountView(dbAccount)["mosaics"].get_array().value;
+		auto index = 0u;
+		for (const auto& mosaicElement : mosaicsView) {
+			if (1357u == test::GetUint64(mosaicElement.get_document().view(), "id"))
+				break;
+
+			++index;
+		}
+
+		// Act:
+		auto dbUpdate = CalculateUpdate(previousAccountState, accountState);
+
+		// Assert:
+		auto view = dbUpdate.view();
+		EXPECT_EQ(1u, test::GetFieldCount(view));
+
+		auto setView = view["$set"].get_document().view();
+		EXPECT_EQ(1u, test::GetFieldCount(setView));
+
+		auto mosaicView = setView["account.mosaics." + std::to_string(index)].get_document().view();
+		EXPECT_EQ(mosaicsView[index].get_document().view(), mosaicView);
+		EXPECT_EQ(445u, test::GetUint64(mosaicView, "amount"));
+	}
+
+	TEST(TEST_CLASS, ToDbUpdateSetsAllMosaicsWhenMosaicIsAdded) {
+		// Arrange:
+		auto previousAccountState = CreateAccountStateWithMosaics();
+		auto accountState = previousAccountState;
+		accountState.Balances.credit(MosaicId(2468), Amount(100));
+
+		// Act:
+		auto dbUpdate = CalculateUpdate(previousAccountState, accountState);
+
+		// Assert:
+		auto view = dbUpdate.view();
+		EXPECT_EQ(1u, test::GetFieldCount(view));
+
+		auto setView = view["$set"].get_document().view();
+		EXPECT_EQ(1u, test::GetFieldCount(setView));
+		EXPECT_EQ(4u, test::GetFieldCount(setView["account.mosaics"].get_array().value));
+	}
+
+	TEST(TEST_CLASS, ToDbUpdateSetsOnlyChangedScalarFieldWhenPublicKeyChanges) {
+		// Arrange:
+		auto previousAccountState = CreateAccountStateWithMosaics();
+		auto accountState = previousAccountState;
+		test::FillWithRandomData(accountState.PublicKey);
+
+		// Act:
+		auto dbUpdate = CalculateUpdate(previousAccountState, accountState);
+
+		// Assert:
+		auto view = dbUpdate.view();
+		EXPECT_EQ(1u, test::GetFieldCount(view));
+
+		auto setView = view["$set"].get_document().view();
+		EXPECT_EQ(1u, test::GetFieldCount(setView));
+
+		Key publicKey;
+		DbBinaryToModelArray(publicKey, setView["account.publicKey"].get_binary());
+		EXPECT_EQ(accountState.PublicKey, publicKey);
+	}
+
+	TEST(TEST_CLASS, ToDbUpdateSetsScalarFieldWhenOnlySingleByteChanges) {
+		// Arrange: change a single bit so that the field only differs in its raw bytes
+		auto previousAccountState = CreateAccountStateWithMosaics();
+		auto accountState = previousAccountState;
+		accountState.PublicKey[Key::Size - 1] ^= 0x01;
+
+		// Act:
+		auto dbUpdate = CalculateUpdate(previousAccountState, accountState);
+
+		// Assert:
+		auto setView = dbUpdate.view()["$set"].get_document().view();
+		EXPECT_EQ(1u, test::GetFieldCount(setView));
+
+		Key publicKey;
+		DbBinaryToModelArray(publicKey, setView["account.publicKey"].get_binary());
+		EXPECT_EQ(accountState.PublicKey, publicKey);
+	}
+
+	TEST(TEST_CLASS, ToDbUpdateSetsAllChangedScalarFields) {
+		// Arrange:
+		auto previousAccountState = CreateAccountStateWithMosaics();
+		auto accountState = previousAccountState;
+		test::FillWithRandomData(accountState.PublicKey);
+		accountState.PublicKeyHeight = accountState.PublicKeyHeight + Height(1);
+
+		// Act:
+		auto dbUpdate = CalculateUpdate(previousAccountState, accountState);
+
+		// Assert:
+		auto setView = dbUpdate.view()["$set"].get_document().view();
+		EXPECT_EQ(2u, test::GetFieldCount(setView));
+		EXPECT_EQ(accountState.PublicKeyHeight.unwrap(), test::GetUint64(setView, "account.publicKeyHeight"));
+	}
+
+	TEST(TEST_CLASS, ToDbUpdateUnsetsRemovedSupplementalPublicKey) {
+		// Arrange:
+		auto previousAccountState = CreateAccountStateWithMosaics();
+		auto accountState = previousAccountState;
+		accountState.SupplementalPublicKeys.linked().unset();
+
+		// Act:
+		auto dbUpdate = CalculateUpdate(previousAccountState, accountState);
+
+		// Assert:
+		auto view = dbUpdate.view();
+		EXPECT_EQ(1u, test::GetFieldCount(view));
+
+		auto unsetView = view["$unset"].get_document().view();
+		EXPECT_EQ(1u, test::GetFieldCount(unsetView));
+		EXPECT_TRUE(!!unsetView["account.supplementalPublicKeys.linked"]);
+	}
+
+	TEST(TEST_CLASS, ToDbUpdateSetsAddedSupplementalPublicKey) {
+		// Arrange:
+		auto previousAccountState = CreateAccountStateWithMosaics();
+		auto accountState = previousAccountState;
+		accountState.SupplementalPublicKeys.node().set(test::GenerateRandomByteArray<Key>());
+
+		// Act:
+		auto dbUpdate = CalculateUpdate(previousAccountState, accountState);
+
+		// Assert:
+		auto view = dbUpdate.view();
+		EXPECT_EQ(1u, test::GetFieldCount(view));
+
+		auto setView = view["$set"].get_document().view();
+		EXPECT_EQ(1u, test::GetFieldCount(setView));
+
+		Key nodePublicKey;
+		DbBinaryToModelArray(nodePublicKey, setView["account.supplementalPublicKeys.node"]["publicKey"].get_binary());
+		EXPECT_EQ(accountState.SupplementalPublicKeys.node().get(), nodePublicKey);
+	}
+
+	// endregion
 }}}
@@ -205,8 +205,11 @@ namespace catapult { namespace sync {
 			syncHandlers.TransactionsChange = state.hooks().transactionsChangeHandler();
 			syncHandlers.CommitStep = extensions::CreateCommitStepHandler(dataDirectory);
 
-			if (state.config().Node.EnableCacheDatabaseStorage)
+			const auto& nodeConfig = state.config().Node;
+			if (nodeConfig.EnableCacheDatabaseStorage)
 				AddSupplementalDataResiliency(syncHandlers, dataDirectory, state.cache(), state.score());
+			else if (0 != nodeConfig.MaxStateDeltaSnapshots)
+				AddDifferentialStateSnapshots(syncHandlers, dataDirectory, nodeConfig, state.cache(), state.score());
 
 			return syncHandlers;
 		}
@@ -20,9 +20,11 @@
 **/
 
 #include "DispatcherSyncHandlers.h"
+#include "catapult/cache/CacheChangesStorage.h"
 #include "catapult/cache/CacheStorage.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/config/NodeConfiguration.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/extensions/LocalNodeStateFileStorage.h"
 
@@ -54,4 +56,64 @@ namespace catapult { namespace sync {
 			commitStepHandler(step);
 		};
 	}
+
+	namespace {
+		struct DifferentialStateSnapshotsState {
+			std::vector<std::unique_ptr<const cache::CacheChangesStorage>> ChangesStorages;
+			Height SerializedHeight;
+			size_t NumSnapshots;
+		};
+	}
+
+	void AddDifferentialStateSnapshots(
+			consumers::BlockChainSyncHandlers& syncHandlers,
+			const config::CatapultDataDirectory& dataDirectory,
+			const config::NodeConfiguration& nodeConfig,
+			const cache::CatapultCache& cache,
+			const extensions::LocalNodeChainScore& score) {
+		// snapshots are only valid on top of serialized state that matches the in-memory state (which is not the case after replaying
+		// blocks during boot, for example), so make sure that the serialized state is current before saving any snapshots
+		auto saveFullState = [dataDirectory, &nodeConfig, &cache, &score]() {
+			extensions::SaveStateToDirectoryWithCheckpointing(dataDirectory, nodeConfig, cache, score.get());
+		};
+		saveFullState();
+
+		// can't create any views (or storages) in PreStateWritten handler because cache lock is held by calling code
+		auto pState = std::make_shared<DifferentialStateSnapshotsState>(DifferentialStateSnapshotsState{
+			cache.changesStorages(),
+			cache.createView().height(),
+			extensions::CountStateDeltaSnapshots(dataDirectory.dir("state"))
+		});
+
+		auto preStateWrittenHandler = syncHandlers.PreStateWritten;
+		syncHandlers.PreStateWritten = [preStateWrittenHandler, pState, dataDirectory, &score](const auto& cacheDelta, auto height) {
+			extensions::LocalNodeStateSerializer serializer(dataDirectory.dir("state.tmp"));
+			serializer.saveChanges(cacheDelta, pState->ChangesStorages, score.get(), pState->SerializedHeight, height);
+
+			preStateWrittenHandler(cacheDelta, height);
+		};
+
+		auto commitStepHandler = syncHandlers.CommitStep;
+		auto maxSnapshots = nodeConfig.MaxStateDeltaSnapshots;
+		syncHandlers.CommitStep = [commitStepHandler, pState, dataDirectory, &cache, maxSnapshots, saveFullState](auto step) {
+			if (consumers::CommitOperationStep::All_Updated != step) {
+				commitStepHandler(step);
+				return;
+			}
+
+			extensions::LocalNodeStateSerializer serializer(dataDirectory.dir("state.tmp"));
+			serializer.moveTo(dataDirectory.dir("state"));
+			commitStepHandler(step);
+
+			// cache lock is released by the time all data is updated, so the in-memory state can be used as the new serialized state
+			pState->SerializedHeight = cache.createView().height();
+			if (++pState->NumSnapshots < maxSnapshots)
+				return;
+
+			// fold all snapshots into a new base state
+			CATAPULT_LOG(info) << "maximum number of differential state snapshots saved, compacting state";
+			saveFullState();
+			pState->NumSnapshots = extensions::CountStateDeltaSnapshots(dataDirectory.dir("state"));
+		};
+	}
 }}
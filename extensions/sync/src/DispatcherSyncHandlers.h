@@ -23,7 +23,10 @@
 #include "catapult/consumers/BlockChainSyncHandlers.h"
 
 namespace catapult {
-	namespace config { class CatapultDataDirectory; }
+	namespace config {
+		class CatapultDataDirectory;
+		struct NodeConfiguration;
+	}
 	namespace extensions { class LocalNodeChainScore; }
 }
 
@@ -35,4 +38,14 @@ namespace catapult { namespace sync {
 			const config::CatapultDataDirectory& dataDirectory,
 			const cache::CatapultCache& cache,
 			const extensions::LocalNodeChainScore& score);
+
+	/// Updates \a syncHandlers to save differential state snapshots given \a dataDirectory, \a nodeConfig, \a cache and \a score.
+	/// \note State is saved in full first when the serialized state does not match \a cache and whenever the maximum
+	///       number of snapshots is reached.
+	void AddDifferentialStateSnapshots(
+			consumers::BlockChainSyncHandlers& syncHandlers,
+			const config::CatapultDataDirectory& dataDirectory,
+			const config::NodeConfiguration& nodeConfig,
+			const cache::CatapultCache& cache,
+			const extensions::LocalNodeChainScore& score);
 }}
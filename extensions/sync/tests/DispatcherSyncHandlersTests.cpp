@@ -22,7 +22,9 @@
 #include "sync/src/DispatcherSyncHandlers.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/config/NodeConfiguration.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
+#include "catapult/extensions/LocalNodeStateFileStorage.h"
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
 #include <filesystem>
@@ -142,4 +144,186 @@ namespace catapult { namespace sync {
 	}
 
 	// endregion
+
+	// region AddDifferentialStateSnapshots
+
+	namespace {
+		class AddDifferentialStateSnapshotsTestContext {
+		public:
+			explicit AddDifferentialStateSnapshotsTestContext(uint32_t maxStateDeltaSnapshots)
+					: m_dataDirectory(m_tempDir.name())
+					, m_nodeConfig(CreateNodeConfiguration(maxStateDeltaSnapshots))
+					, m_cache({})
+					, m_numPreStateWrittenCalls(0)
+					, m_numCommitStepCalls(0) {
+				addDifferentialStateSnapshots();
+			}
+
+		public:
+			size_t numPreStateWrittenCalls() const {
+				return m_numPreStateWrittenCalls;
+			}
+
+			size_t numCommitStepCalls() const {
+				return m_numCommitStepCalls;
+			}
+
+			size_t countSnapshots(const std::string& directory) const {
+				return extensions::CountStateDeltaSnapshots(m_dataDirectory.dir(directory));
+			}
+
+			bool hasSerializedState() const {
+				return extensions::HasSerializedState(m_dataDirectory.dir("state"));
+			}
+
+		public:
+			void addDifferentialStateSnapshots() {
+				m_syncHandlers.PreStateWritten = [this](const auto&, auto) {
+					++m_numPreStateWrittenCalls;
+				};
+				m_syncHandlers.CommitStep = [this](auto) {
+					++m_numCommitStepCalls;
+				};
+
+				AddDifferentialStateSnapshots(m_syncHandlers, m_dataDirectory, m_nodeConfig, m_cache, m_score);
+			}
+
+			void resetCache() {
+				m_cache = cache::CatapultCache({});
+			}
+
+			void commit(Height height) {
+				{
+					auto cacheDelta = m_cache.createDelta();
+					m_syncHandlers.PreStateWritten(cacheDelta, height);
+					m_syncHandlers.CommitStep(consumers::CommitOperationStep::State_Written);
+				}
+
+				m_cache.commit(height);
+				m_syncHandlers.CommitStep(consumers::CommitOperationStep::All_Updated);
+			}
+
+			void preStateWritten(Height height) {
+				m_syncHandlers.PreStateWritten(m_cache.createDelta(), height);
+			}
+
+			void loadState() {
+				auto cache = cache::CatapultCache({});
+				extensions::LoadDependentStateFromDirectory(m_dataDirectory.dir("state"), cache);
+				m_loadedHeight = cache.createView().height();
+			}
+
+			Height loadedHeight() const {
+				return m_loadedHeight;
+			}
+
+		private:
+			static config::NodeConfiguration CreateNodeConfiguration(uint32_t maxStateDeltaSnapshots) {
+				auto nodeConfig = config::NodeConfiguration::Uninitialized();
+				nodeConfig.MaxStateDeltaSnapshots = maxStateDeltaSnapshots;
+				return nodeConfig;
+			}
+
+		private:
+			test::TempDirectoryGuard m_tempDir;
+			config::CatapultDataDirectory m_dataDirectory;
+			config::NodeConfiguration m_nodeConfig;
+			cache::CatapultCache m_cache;
+			extensions::LocalNodeChainScore m_score;
+			size_t m_numPreStateWrittenCalls;
+			size_t m_numCommitStepCalls;
+			Height m_loadedHeight;
+			consumers::BlockChainSyncHandlers m_syncHandlers;
+		};
+	}
+
+	TEST(TEST_CLASS, AddDifferentialStateSnapshots_SavesFullStateWhenNoStateIsSerialized) {
+		// Act:
+		AddDifferentialStateSnapshotsTestContext context(3);
+
+		// Assert:
+		EXPECT_TRUE(context.hasSerializedState());
+		EXPECT_EQ(0u, context.countSnapshots("state"));
+	}
+
+	TEST(TEST_CLASS, AddDifferentialStateSnapshots_PreStateWrittenWritesDifferentialStateToTempDirectory) {
+		// Arrange:
+		AddDifferentialStateSnapshotsTestContext context(3);
+
+		// Act:
+		context.preStateWritten(Height(1));
+
+		// Assert:
+		EXPECT_EQ(1u, context.numPreStateWrittenCalls());
+		EXPECT_EQ(1u, context.countSnapshots("state.tmp"));
+		EXPECT_EQ(0u, context.countSnapshots("state"));
+	}
+
+	TEST(TEST_CLASS, AddDifferentialStateSnapshots_CommitStepMergesDifferentialStateWhenOperationIsAllUpdated) {
+		// Arrange:
+		AddDifferentialStateSnapshotsTestContext context(3);
+
+		// Act:
+		context.commit(Height(1));
+		context.commit(Height(2));
+
+		// Assert:
+		EXPECT_EQ(2u, context.numPreStateWrittenCalls());
+		EXPECT_EQ(4u, context.numCommitStepCalls());
+		EXPECT_EQ(0u, context.countSnapshots("state.tmp"));
+		EXPECT_EQ(2u, context.countSnapshots("state"));
+
+		context.loadState();
+		EXPECT_EQ(Height(2), context.loadedHeight());
+	}
+
+	TEST(TEST_CLASS, AddDifferentialStateSnapshots_CompactsStateWhenMaxSnapshotsAreSaved) {
+		// Arrange:
+		AddDifferentialStateSnapshotsTestContext context(2);
+
+		// Act:
+		for (auto i = 0u; i < 5; ++i)
+			context.commit(Height(1 + i));
+
+		// Assert: differential state continues to be written after compaction and downstream handlers are still called
+		EXPECT_EQ(5u, context.numPreStateWrittenCalls());
+		EXPECT_EQ(10u, context.numCommitStepCalls());
+		EXPECT_EQ(0u, context.countSnapshots("state.tmp"));
+		EXPECT_EQ(1u, context.countSnapshots("state"));
+
+		context.loadState();
+		EXPECT_EQ(Height(5), context.loadedHeight());
+	}
+
+	TEST(TEST_CLASS, AddDifferentialStateSnapshots_SavesFullStateWhenSerializedStateDoesNotMatchCache) {
+		// Arrange: serialize state at height 2 and then use a cache at a different height
+		AddDifferentialStateSnapshotsTestContext context(3);
+		context.commit(Height(1));
+		context.commit(Height(2));
+		context.resetCache();
+
+		// Act:
+		context.addDifferentialStateSnapshots();
+
+		// Assert: stale snapshots were folded into a new base state matching the cache
+		EXPECT_EQ(0u, context.countSnapshots("state"));
+
+		context.loadState();
+		EXPECT_EQ(Height(0), context.loadedHeight());
+	}
+
+	TEST(TEST_CLASS, AddDifferentialStateSnapshots_DoesNotSaveFullStateWhenSerializedStateMatchesCache) {
+		// Arrange:
+		AddDifferentialStateSnapshotsTestContext context(3);
+		context.commit(Height(1));
+		context.commit(Height(2));
+
+		// Act:
+		context.addDifferentialStateSnapshots();
+
+		// Assert:
+		EXPECT_EQ(2u, context.countSnapshots("state"));
+	}
+
+	// endregion
 }}
@@ -38,7 +38,8 @@ namespace catapult { namespace zeromq {
 			auto pZeroEntityPublisher = std::make_shared<ZeroMqEntityPublisher>(
 					config.ListenInterface,
 					config.SubscriberPort,
-					bootstrapper.pluginManager().createNotificationPublisher());
+					bootstrapper.pluginManager().createNotificationPublisher(),
+					config.MaxQueueSize);
 
 			// add a dummy service for extending service lifetimes
 			bootstrapper.extensionManager().addServiceRegistrar(extensions::CreateRootedServiceRegistrar(
@@ -35,6 +35,9 @@ namespace catapult { namespace zeromq {
 		/// Subscriber port.
 		unsigned short SubscriberPort;
 
+		/// Maximum number of message groups queued for the publisher thread.
+		uint32_t MaxQueueSize;
+
 	private:
 		MessagingConfiguration() = default;
 
@@ -28,9 +28,13 @@
 #include "catapult/model/NotificationSubscriber.h"
 #include "catapult/model/TransactionStatus.h"
 #include "catapult/model/TransactionUtils.h"
-#include "catapult/thread/IoThreadPool.h"
-#include <boost/asio.hpp>
+#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/ThrottleLogger.h"
+#include <array>
+#include <map>
+#include <mutex>
 #include <set>
+#include <thread>
 
 namespace catapult { namespace zeromq {
 
@@ -59,10 +63,22 @@ namespace catapult { namespace zeromq {
 	};
 
 	class ZeroMqEntityPublisher::SynchronizedPublisher {
+	private:
+		static constexpr auto Wakeup_Endpoint = "inproc://publisher_wakeup";
+
+		// minimum interval between two logs of queue statistics
+		static constexpr uint64_t Statistics_Log_Interval_Millis = 60'000;
+
 	public:
-		SynchronizedPublisher(const std::string& listenInterface, unsigned short port)
-				: m_zmqSocket(m_zmqContext, ZMQ_PUB)
-				, m_pPool(thread::CreateIoThreadPool(1, "ZeroMqEntityPublisher")) {
+		SynchronizedPublisher(const std::string& listenInterface, unsigned short port, size_t maxQueueSize)
+				: m_maxQueueSize(maxQueueSize)
+				, m_zmqSocket(m_zmqContext, ZMQ_XPUB)
+				, m_wakeupReceiverSocket(m_zmqContext, ZMQ_PAIR)
+				, m_wakeupSenderSocket(m_zmqContext, ZMQ_PAIR)
+				, m_isStopped(false)
+				, m_maxQueueSizeSinceLastLog(0)
+				, m_numDroppedMessageGroups(0)
+				, m_statisticsLogThrottle(Statistics_Log_Interval_Millis) {
 			// note that we want closing the socket to be synchronous
 			// setting linger to 0 means that all pending messages are discarded and the socket is closed immediately
 			m_zmqSocket.set(zmq::sockopt::linger, 0);
@@ -73,28 +89,171 @@ namespace catapult { namespace zeromq {
 			out << "tcp://[" << listenInterface << "]:" << port;
 			m_zmqSocket.bind(out.str());
 
-			m_pPool->start();
+			// publisher thread is woken up by a message on the wakeup socket when message groups are queued
+			m_wakeupReceiverSocket.set(zmq::sockopt::linger, 0);
+			m_wakeupSenderSocket.set(zmq::sockopt::linger, 0);
+			m_wakeupReceiverSocket.bind(Wakeup_Endpoint);
+			m_wakeupSenderSocket.connect(Wakeup_Endpoint);
+
+			m_thread = std::thread([this]() { run(); });
 		}
 
 		~SynchronizedPublisher() {
-			// stop the pool first to prevent any work from being written to (closed) socket
-			m_pPool->join();
+			// stop the publisher thread first to prevent any work from being written to (closed) socket
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_isStopped = true;
+				wakeup();
+			}
+
+			m_thread.join();
+			m_wakeupSenderSocket.close();
+			m_wakeupReceiverSocket.close();
 			m_zmqSocket.close();
 		}
 
+	public:
+		size_t queueSize() const {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_messageGroups.size();
+		}
+
+		uint64_t numDroppedMessageGroups() const {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_numDroppedMessageGroups;
+		}
+
+		bool hasSubscriber(const void* pTopic, size_t topicSize) const {
+			const auto* pTopicBytes = reinterpret_cast<const uint8_t*>(pTopic);
+
+			// zeromq subscriptions are prefix based, so check all subscribed prefix sizes
+			auto readLock = m_subscriptionsLock.acquireReader();
+			for (const auto& pair : m_subscriptionSizeCounts) {
+				if (pair.first > topicSize)
+					continue;
+
+				if (m_subscriptions.cend() != m_subscriptions.find(std::vector<uint8_t>(pTopicBytes, pTopicBytes + pair.first)))
+					return true;
+			}
+
+			return false;
+		}
+
 	public:
 		void queue(std::unique_ptr<MessageGroup>&& pMessageGroup) {
-			// dispatch function needs to be copyable
-			auto pMessageGroupShared = std::shared_ptr<MessageGroup>(std::move(pMessageGroup));
-			boost::asio::dispatch(m_pPool->ioContext(), [&zmqSocket = m_zmqSocket, pMessageGroup{std::move(pMessageGroupShared)}]() {
-				pMessageGroup->flush(zmqSocket);
-			});
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_messageGroups.size() >= m_maxQueueSize) {
+				++m_numDroppedMessageGroups;
+				CATAPULT_LOG_THROTTLE(warning, Statistics_Log_Interval_Millis)
+						<< "zeromq publisher queue is full, dropped message groups: " << m_numDroppedMessageGroups;
+				return;
+			}
+
+			// publisher thread takes all queued message groups at once, so it only needs to be woken up by the first one
+			if (m_messageGroups.empty())
+				wakeup();
+
+			m_messageGroups.push_back(std::move(pMessageGroup));
+			m_maxQueueSizeSinceLastLog = std::max(m_maxQueueSizeSinceLastLog, m_messageGroups.size());
 		}
 
 	private:
+		void wakeup() {
+			// wakeup socket is only used while holding m_mutex
+			m_wakeupSenderSocket.send(zmq::message_t(), zmq::send_flags::dontwait);
+		}
+
+		void run() {
+			std::array<zmq::pollitem_t, 2> pollItems{ {
+				{ m_zmqSocket.handle(), 0, ZMQ_POLLIN, 0 },
+				{ m_wakeupReceiverSocket.handle(), 0, ZMQ_POLLIN, 0 }
+			} };
+
+			std::vector<std::unique_ptr<MessageGroup>> messageGroups;
+			for (;;) {
+				// block until subscriptions change or message groups are queued
+				try {
+					zmq::poll(pollItems.data(), pollItems.size(), std::chrono::milliseconds(-1));
+				} catch (const zmq::error_t& ex) {
+					if (EINTR != ex.num())
+						throw;
+				}
+
+				zmq::message_t message;
+				while (m_wakeupReceiverSocket.recv(message, zmq::recv_flags::dontwait)) {}
+
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					if (m_isStopped)
+						return;
+
+					// take all queued message groups at once so that producers are not blocked while sending
+					messageGroups.swap(m_messageGroups);
+				}
+
+				processSubscriptions();
+
+				for (const auto& pMessageGroup : messageGroups)
+					pMessageGroup->flush(m_zmqSocket);
+
+				messageGroups.clear();
+				logStatistics();
+			}
+		}
+
+		void logStatistics() {
+			if (m_statisticsLogThrottle.isThrottled())
+				return;
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			CATAPULT_LOG(info)
+					<< "zeromq publisher statistics: max queue size " << m_maxQueueSizeSinceLastLog
+					<< ", dropped message groups " << m_numDroppedMessageGroups;
+			m_maxQueueSizeSinceLastLog = 0;
+		}
+
+		void processSubscriptions() {
+			// xpub sockets forward the first subscription and the last unsubscription of each topic
+			zmq::message_t message;
+			while (m_zmqSocket.recv(message, zmq::recv_flags::dontwait)) {
+				if (0 == message.size())
+					continue;
+
+				const auto* pMessageBytes = message.data<uint8_t>();
+				auto topic = std::vector<uint8_t>(pMessageBytes + 1, pMessageBytes + message.size());
+				auto topicSize = topic.size();
+
+				auto writeLock = m_subscriptionsLock.acquireWriter();
+				if (1 == pMessageBytes[0]) {
+					if (m_subscriptions.insert(std::move(topic)).second)
+						++m_subscriptionSizeCounts[topicSize];
+				} else if (0 == pMessageBytes[0] && m_subscriptions.erase(topic)) {
+					if (0 == --m_subscriptionSizeCounts[topicSize])
+						m_subscriptionSizeCounts.erase(topicSize);
+				}
+			}
+		}
+
+	private:
+		size_t m_maxQueueSize;
 		zmq::context_t m_zmqContext;
 		zmq::socket_t m_zmqSocket;
-		std::unique_ptr<thread::IoThreadPool> m_pPool;
+
+		zmq::socket_t m_wakeupReceiverSocket;
+		zmq::socket_t m_wakeupSenderSocket;
+
+		mutable std::mutex m_mutex;
+		std::vector<std::unique_ptr<MessageGroup>> m_messageGroups;
+		bool m_isStopped;
+		size_t m_maxQueueSizeSinceLastLog;
+		uint64_t m_numDroppedMessageGroups;
+		utils::ThrottleLogger m_statisticsLogThrottle;
+
+		mutable utils::SpinReaderWriterLock m_subscriptionsLock;
+		std::set<std::vector<uint8_t>> m_subscriptions;
+		std::map<size_t, size_t> m_subscriptionSizeCounts;
+
+		std::thread m_thread; // must be last member because it accesses all other members
 	};
 
 	struct ZeroMqEntityPublisher::WeakTransactionInfo {
@@ -104,6 +263,7 @@ namespace catapult { namespace zeromq {
 				, EntityHash(transactionInfo.EntityHash)
 				, MerkleComponentHash(transactionInfo.MerkleComponentHash)
 				, OptionalAddresses(transactionInfo.OptionalExtractedAddresses.get())
+				, pOptionalTransactionOwner(transactionInfo.pEntity)
 		{}
 
 		explicit WeakTransactionInfo(const model::TransactionElement& element)
@@ -125,18 +285,91 @@ namespace catapult { namespace zeromq {
 		const Hash256& EntityHash;
 		const Hash256& MerkleComponentHash;
 		const model::UnresolvedAddressSet* OptionalAddresses;
+
+		/// Shared owner of the transaction, when available.
+		std::shared_ptr<const void> pOptionalTransactionOwner;
+	};
+
+	/// Message payload frames that are shared (without copying) by all messages published for a single entity.
+	class ZeroMqEntityPublisher::MessagePayload {
+	private:
+		struct SharedState {
+			std::shared_ptr<const void> pOwner;
+			std::vector<uint8_t> Buffer;
+		};
+
+		struct Frame {
+			const void* pExternalData;
+			size_t BufferOffset;
+			size_t Size;
+		};
+
+	public:
+		/// Creates a payload that can reference data owned by \a pOwner.
+		explicit MessagePayload(const std::shared_ptr<const void>& pOwner) : m_pState(std::make_shared<SharedState>()) {
+			m_pState->pOwner = pOwner;
+		}
+
+	public:
+		/// Adds a frame referencing \a size bytes at \a pData that are kept alive by the payload owner.
+		void addReference(const void* pData, size_t size) {
+			m_frames.push_back({ pData, 0, size });
+		}
+
+		/// Adds a frame composed of a copy of \a size bytes at \a pData.
+		void addCopy(const void* pData, size_t size) {
+			const auto* pDataBytes = reinterpret_cast<const uint8_t*>(pData);
+			m_frames.push_back({ nullptr, m_pState->Buffer.size(), size });
+			m_pState->Buffer.insert(m_pState->Buffer.end(), pDataBytes, pDataBytes + size);
+		}
+
+		/// Adds a frame composed of a copy of \a value.
+		template<typename TValue>
+		void addCopy(const TValue& value) {
+			addCopy(&value, sizeof(TValue));
+		}
+
+	public:
+		/// Appends all payload frames to \a multipart without copying any payload data.
+		void appendTo(zmq::multipart_t& multipart) const {
+			for (const auto& frame : m_frames) {
+				const auto* pData = frame.pExternalData ? frame.pExternalData : m_pState->Buffer.data() + frame.BufferOffset;
+
+				// each frame holds a reference to the shared state, which is dropped by zeromq once the frame has been sent
+				auto* pStateReference = new std::shared_ptr<SharedState>(m_pState);
+				multipart.add(zmq::message_t(const_cast<void*>(pData), frame.Size, ReleaseStateReference, pStateReference));
+			}
+		}
+
+	private:
+		static void ReleaseStateReference(void*, void* pHint) {
+			delete reinterpret_cast<std::shared_ptr<SharedState>*>(pHint);
+		}
+
+	private:
+		std::shared_ptr<SharedState> m_pState;
+		std::vector<Frame> m_frames;
 	};
 
 	ZeroMqEntityPublisher::ZeroMqEntityPublisher(
 			const std::string& listenInterface,
 			unsigned short port,
-			std::unique_ptr<const model::NotificationPublisher>&& pNotificationPublisher)
+			std::unique_ptr<const model::NotificationPublisher>&& pNotificationPublisher,
+			size_t maxQueueSize)
 			: m_pNotificationPublisher(std::move(pNotificationPublisher))
-			, m_pSynchronizedPublisher(std::make_unique<SynchronizedPublisher>(listenInterface, port))
+			, m_pSynchronizedPublisher(std::make_unique<SynchronizedPublisher>(listenInterface, port, maxQueueSize))
 	{}
 
 	ZeroMqEntityPublisher::~ZeroMqEntityPublisher() = default;
 
+	size_t ZeroMqEntityPublisher::queueSize() const {
+		return m_pSynchronizedPublisher->queueSize();
+	}
+
+	uint64_t ZeroMqEntityPublisher::numDroppedMessageGroups() const {
+		return m_pSynchronizedPublisher->numDroppedMessageGroups();
+	}
+
 	namespace {
 		auto CreateHeightMessageGenerator(const std::string& topicName, Height height) {
 			return [topicName, height]() {
@@ -148,10 +381,13 @@ namespace catapult { namespace zeromq {
 	}
 
 	void ZeroMqEntityPublisher::publishBlockHeader(const model::BlockElement& blockElement) {
+		auto marker = BlockMarker::Block_Marker;
+		if (!m_pSynchronizedPublisher->hasSubscriber(&marker, sizeof(BlockMarker)))
+			return;
+
 		auto pMessageGroup = std::make_unique<MessageGroup>(CreateHeightMessageGenerator("block header", blockElement.Block.Height));
 
 		zmq::multipart_t multipart;
-		auto marker = BlockMarker::Block_Marker;
 		multipart.addmem(&marker, sizeof(BlockMarker));
 		multipart.addmem(static_cast<const void*>(&blockElement.Block), model::GetBlockHeaderSize(blockElement.Block.Type));
 		multipart.addmem(static_cast<const void*>(&blockElement.EntityHash), Hash256::Size);
@@ -161,10 +397,13 @@ namespace catapult { namespace zeromq {
 	}
 
 	void ZeroMqEntityPublisher::publishDropBlocks(Height height) {
+		auto marker = BlockMarker::Drop_Blocks_Marker;
+		if (!m_pSynchronizedPublisher->hasSubscriber(&marker, sizeof(BlockMarker)))
+			return;
+
 		auto pMessageGroup = std::make_unique<MessageGroup>(CreateHeightMessageGenerator("drop blocks", height));
 
 		zmq::multipart_t multipart;
-		auto marker = BlockMarker::Drop_Blocks_Marker;
 		multipart.addmem(&marker, sizeof(BlockMarker));
 		multipart.addmem(static_cast<const void*>(&height), sizeof(Height));
 		pMessageGroup->add(std::move(multipart));
@@ -172,10 +411,13 @@ namespace catapult { namespace zeromq {
 	}
 
 	void ZeroMqEntityPublisher::publishFinalizedBlock(const PackedFinalizedBlockHeader& header) {
+		auto marker = BlockMarker::Finalized_Block_Marker;
+		if (!m_pSynchronizedPublisher->hasSubscriber(&marker, sizeof(BlockMarker)))
+			return;
+
 		auto pMessageGroup = std::make_unique<MessageGroup>(CreateHeightMessageGenerator("finalized block", header.Height));
 
 		zmq::multipart_t multipart;
-		auto marker = BlockMarker::Finalized_Block_Marker;
 		multipart.addmem(&marker, sizeof(BlockMarker));
 		multipart.addmem(static_cast<const void*>(&header), sizeof(PackedFinalizedBlockHeader));
 		pMessageGroup->add(std::move(multipart));
@@ -208,8 +450,8 @@ namespace catapult { namespace zeromq {
 
 	void ZeroMqEntityPublisher::publishTransactionHash(TransactionMarker topicMarker, const model::TransactionInfo& transactionInfo) {
 		const auto& hash = transactionInfo.EntityHash;
-		publish("transaction hash", topicMarker, WeakTransactionInfo(transactionInfo), [&hash](auto& multipart) {
-			multipart.addmem(static_cast<const void*>(&hash), Hash256::Size);
+		publish("transaction hash", topicMarker, WeakTransactionInfo(transactionInfo), [&hash](auto& payload) {
+			payload.addCopy(hash);
 		});
 	}
 
@@ -217,20 +459,25 @@ namespace catapult { namespace zeromq {
 			TransactionMarker topicMarker,
 			const WeakTransactionInfo& transactionInfo,
 			Height height) {
-		publish("transaction", topicMarker, transactionInfo, [&transactionInfo, height](auto& multipart) {
+		publish("transaction", topicMarker, transactionInfo, [&transactionInfo, height](auto& payload) {
+			// reference shared transactions directly and copy unowned ones once for all topics
 			const auto& transaction = transactionInfo.Transaction;
-			multipart.addmem(static_cast<const void*>(&transaction), transaction.Size);
-			multipart.addmem(static_cast<const void*>(&transactionInfo.EntityHash), Hash256::Size);
-			multipart.addmem(static_cast<const void*>(&transactionInfo.MerkleComponentHash), Hash256::Size);
-			multipart.addtyp(height);
+			if (transactionInfo.pOptionalTransactionOwner)
+				payload.addReference(&transaction, transaction.Size);
+			else
+				payload.addCopy(&transaction, transaction.Size);
+
+			payload.addCopy(transactionInfo.EntityHash);
+			payload.addCopy(transactionInfo.MerkleComponentHash);
+			payload.addCopy(height);
 		});
 	}
 
 	void ZeroMqEntityPublisher::publishTransactionStatus(const model::Transaction& transaction, const Hash256& hash, uint32_t status) {
 		auto topicMarker = TransactionMarker::Transaction_Status_Marker;
 		model::TransactionStatus transactionStatus(hash, transaction.Deadline, status);
-		publish("transaction status", topicMarker, WeakTransactionInfo(transaction, hash), [&transactionStatus](auto& multipart) {
-			multipart.addmem(static_cast<const void*>(&transactionStatus), sizeof(model::TransactionStatus));
+		publish("transaction status", topicMarker, WeakTransactionInfo(transaction, hash), [&transactionStatus](auto& payload) {
+			payload.addCopy(transactionStatus);
 		});
 	}
 
@@ -239,8 +486,8 @@ namespace catapult { namespace zeromq {
 			const model::Cosignature& cosignature) {
 		auto topicMarker = TransactionMarker::Cosignature_Marker;
 		model::DetachedCosignature detachedCosignature(cosignature, parentTransactionInfo.EntityHash);
-		publish("detached cosignature", topicMarker, WeakTransactionInfo(parentTransactionInfo), [&detachedCosignature](auto& multipart) {
-			multipart.addmem(static_cast<const void*>(&detachedCosignature), sizeof(model::DetachedCosignature));
+		publish("detached cosignature", topicMarker, WeakTransactionInfo(parentTransactionInfo), [&detachedCosignature](auto& payload) {
+			payload.addCopy(detachedCosignature);
 		});
 	}
 
@@ -258,14 +505,25 @@ namespace catapult { namespace zeromq {
 		if (addresses.empty())
 			CATAPULT_LOG(warning) << "no addresses are associated with transaction " << transactionInfo.EntityHash;
 
+		// build the payload once (only when some topic has a subscriber) and share its frames across all address topics
+		std::unique_ptr<MessagePayload> pPayload;
 		for (const auto& address : addresses) {
-			zmq::multipart_t multipart;
 			auto topic = CreateTopic(topicMarker, address);
+			if (!m_pSynchronizedPublisher->hasSubscriber(topic.data(), topic.size()))
+				continue;
+
+			if (!pPayload) {
+				pPayload = std::make_unique<MessagePayload>(transactionInfo.pOptionalTransactionOwner);
+				payloadBuilder(*pPayload);
+			}
+
+			zmq::multipart_t multipart;
 			multipart.addmem(topic.data(), topic.size());
-			payloadBuilder(multipart);
+			pPayload->appendTo(multipart);
 			pMessageGroup->add(std::move(multipart));
 		}
 
-		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+		if (pPayload)
+			m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
 	}
 }}
@@ -87,14 +87,24 @@ namespace catapult { namespace zeromq {
 	/// Zeromq entity publisher.
 	class ZeroMqEntityPublisher {
 	public:
-		/// Creates a zeromq entity publisher around \a listenInterface, \a port and \a pNotificationPublisher.
+		/// Creates a zeromq entity publisher around \a listenInterface, \a port and \a pNotificationPublisher
+		/// that queues at most \a maxQueueSize message groups for its publisher thread.
+		/// \note Messages are only published to topics that have subscribers.
 		ZeroMqEntityPublisher(
 				const std::string& listenInterface,
 				unsigned short port,
-				std::unique_ptr<const model::NotificationPublisher>&& pNotificationPublisher);
+				std::unique_ptr<const model::NotificationPublisher>&& pNotificationPublisher,
+				size_t maxQueueSize);
 
 		~ZeroMqEntityPublisher();
 
+	public:
+		/// Gets the number of message groups waiting to be sent.
+		size_t queueSize() const;
+
+		/// Gets the number of message groups dropped because the queue was full.
+		uint64_t numDroppedMessageGroups() const;
+
 	public:
 		/// Publishes the block header in \a blockElement.
 		void publishBlockHeader(const model::BlockElement& blockElement);
@@ -122,7 +132,8 @@ namespace catapult { namespace zeromq {
 
 	private:
 		struct WeakTransactionInfo;
-		using MessagePayloadBuilder = consumer<zmq::multipart_t&>;
+		class MessagePayload;
+		using MessagePayloadBuilder = consumer<MessagePayload&>;
 
 		void publishTransaction(TransactionMarker topicMarker, const WeakTransactionInfo& transactionInfo, Height height);
 		void publish(
@@ -30,6 +30,7 @@
 #include "catapult/model/TransactionStatus.h"
 #include "zeromq/tests/test/ZeroMqTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/TestHarness.h"
@@ -108,6 +109,56 @@ namespace catapult { namespace zeromq {
 		context.destroyPublisher();
 	}
 
+	TEST(TEST_CLASS, PublisherInitiallyHasEmptyQueue) {
+		// Act:
+		EntityPublisherContext context;
+
+		// Assert:
+		EXPECT_EQ(0u, context.publisher().queueSize());
+		EXPECT_EQ(0u, context.publisher().numDroppedMessageGroups());
+	}
+
+	TEST(TEST_CLASS, PublisherDoesNotQueueMessagesWithoutSubscribers) {
+		// Arrange: only subscribe to drop blocks
+		EntityPublisherContext context;
+		context.subscribe(BlockMarker::Drop_Blocks_Marker);
+
+		// Act:
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		context.publishFinalizedBlock({ FinalizationEpoch(24), FinalizationPoint(55) }, Height(123), hash);
+
+		// Assert: the message was neither queued nor dropped
+		EXPECT_EQ(0u, context.publisher().queueSize());
+		EXPECT_EQ(0u, context.publisher().numDroppedMessageGroups());
+		test::AssertNoPendingMessages(context.zmqSocket());
+	}
+
+	TEST(TEST_CLASS, PublisherDropsMessagesWhenQueueIsFull) {
+		// Arrange: use a publisher that cannot queue any messages
+		EntityPublisherContext context("127.0.0.1", 0);
+		auto marker = BlockMarker::Drop_Blocks_Marker;
+		context.zmqSocket().set(zmq::sockopt::subscribe, zmq::const_buffer(&marker, sizeof(BlockMarker)));
+
+		// - messages are only queued (and dropped) after the publisher has processed the subscription
+		constexpr auto Max_Attempts = 100u;
+		for (auto i = 0u; i < Max_Attempts && 0 == context.publisher().numDroppedMessageGroups(); ++i) {
+			context.publishDropBlocks(Height(123));
+			test::Sleep(10);
+		}
+
+		auto numInitialDroppedMessageGroups = context.publisher().numDroppedMessageGroups();
+		ASSERT_NE(0u, numInitialDroppedMessageGroups);
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i)
+			context.publishDropBlocks(Height(123));
+
+		// Assert:
+		EXPECT_EQ(0u, context.publisher().queueSize());
+		EXPECT_EQ(numInitialDroppedMessageGroups + 3, context.publisher().numDroppedMessageGroups());
+		test::AssertNoPendingMessages(context.zmqSocket());
+	}
+
 	namespace {
 		void AssertCanUseCustomListenInterface(const std::string& listenInterface) {
 			// Arrange:
@@ -279,6 +330,52 @@ namespace catapult { namespace zeromq {
 		});
 	}
 
+	TEST(TEST_CLASS, PublishTransactionKeepsTransactionAliveUntilMessagesAreSent_TransactionInfo) {
+		// Arrange:
+		EntityPublisherContext context;
+		auto transactionInfo = ToTransactionInfo(mocks::CreateMockTransaction(0));
+		auto expectedTransactionInfo = transactionInfo.copy();
+		expectedTransactionInfo.pEntity = test::CopyEntity(*transactionInfo.pEntity);
+		Height height(123);
+		auto addresses = test::ExtractAddresses(test::ToMockTransaction(*transactionInfo.pEntity));
+		context.subscribeAll(Marker, addresses);
+
+		// Act: release the original transaction immediately after publishing
+		context.publishTransaction(Marker, transactionInfo, height);
+		transactionInfo.pEntity.reset();
+
+		// Assert: all messages reference the (still alive) transaction
+		auto& zmqSocket = context.zmqSocket();
+		test::AssertMessages(zmqSocket, Marker, addresses, [&expectedTransactionInfo, height](const auto& message, const auto& topic) {
+			test::AssertTransactionInfoMessage(message, topic, expectedTransactionInfo, height);
+		});
+	}
+
+	TEST(TEST_CLASS, PublishTransactionCopiesUnsharedTransaction_TransactionElement) {
+		// Arrange:
+		EntityPublisherContext context;
+		auto pTransaction = mocks::CreateMockTransaction(0);
+		auto pExpectedTransaction = test::CopyEntity(*pTransaction);
+		auto expectedTransactionElement = ToTransactionElement(*pExpectedTransaction);
+		auto transactionElement = model::TransactionElement(*pTransaction);
+		transactionElement.EntityHash = expectedTransactionElement.EntityHash;
+		transactionElement.MerkleComponentHash = expectedTransactionElement.MerkleComponentHash;
+		Height height(123);
+		auto addresses = test::ExtractAddresses(test::ToMockTransaction(*pTransaction));
+		context.subscribeAll(Marker, addresses);
+
+		// Act: destroy the original transaction immediately after publishing
+		context.publishTransaction(Marker, transactionElement, height);
+		test::FillWithRandomData({ reinterpret_cast<uint8_t*>(pTransaction.get()), pTransaction->Size });
+		pTransaction.reset();
+
+		// Assert: all messages contain the original transaction data
+		auto& zmqSocket = context.zmqSocket();
+		test::AssertMessages(zmqSocket, Marker, addresses, [&expectedTransactionElement, height](const auto& message, const auto& topic) {
+			test::AssertTransactionElementMessage(message, topic, expectedTransactionElement, height);
+		});
+	}
+
 	TEST(TEST_CLASS, PublishTransactionDeliversMessagesOnlyToRegisteredSubscribers) {
 		// Arrange:
 		EntityPublisherContext context;
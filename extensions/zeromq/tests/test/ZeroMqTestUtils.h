@@ -125,12 +125,17 @@ namespace catapult { namespace test {
 	class MqContext {
 	public:
 		/// Creates a message queue context around \a listenInterface.
-		explicit MqContext(const std::string& listenInterface = std::string("127.0.0.1"))
+		explicit MqContext(const std::string& listenInterface = std::string("127.0.0.1")) : MqContext(listenInterface, 10'000)
+		{}
+
+		/// Creates a message queue context around \a listenInterface with a custom maximum publisher queue size (\a maxQueueSize).
+		MqContext(const std::string& listenInterface, size_t maxQueueSize)
 				: m_registry(mocks::CreateDefaultTransactionRegistry())
 				, m_pZeroMqEntityPublisher(std::make_shared<zeromq::ZeroMqEntityPublisher>(
 						listenInterface,
 						GetDefaultLocalHostZmqPort(),
-						model::CreateNotificationPublisher(m_registry, UnresolvedMosaicId(), Height())))
+						model::CreateNotificationPublisher(m_registry, UnresolvedMosaicId(), Height()),
+						maxQueueSize))
 				, m_zmqSocket(m_zmqContext, ZMQ_SUB) {
 			m_zmqSocket.set(zmq::sockopt::rcvtimeo, 10);
 			if (std::string::npos != listenInterface.find(':'))
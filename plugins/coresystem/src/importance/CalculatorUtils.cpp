@@ -94,45 +94,54 @@ namespace catapult { namespace importance {
 
 	// region CalculateImportances
 
-	void CalculateImportances(
-			AccountSummary& accountSummary,
+	AccountImportances CalculateImportances(
+			Amount balance,
+			const AccountActivitySummary& activitySummary,
 			const ImportanceCalculationContext& context,
 			const model::BlockChainConfiguration& config) {
 		// note that at least one compiler is known to produce invalid code if you alter calculations in incorrect way
 		auto totalChainImportance = config.TotalChainImportance;
-		auto mosaicId = config.HarvestingMosaicId;
 		auto importanceActivityPercentage = config.ImportanceActivityPercentage;
 		auto minHarvesterBalance = config.MinHarvesterBalance;
 
 		// 1. stake
 		boost::multiprecision::uint128_t stakeImportance = totalChainImportance.unwrap();
-		stakeImportance *= accountSummary.pAccountState->Balances.get(mosaicId).unwrap();
+		stakeImportance *= balance.unwrap();
 		stakeImportance *= (100 - importanceActivityPercentage);
 		stakeImportance /= context.ActiveHarvestingMosaics.unwrap() * 100;
-		accountSummary.StakeImportance = Importance(static_cast<Importance::ValueType>(stakeImportance));
 
 		// 2. fees paid: importanceActivityPercentage * (minHarvesterBalance / stake) * 0.8 * feePercentage
 		boost::multiprecision::uint128_t feeImportance(0);
 		if (0 < importanceActivityPercentage && 0u < context.TotalFeesPaid.unwrap()) {
 			feeImportance = totalChainImportance.unwrap();
-			feeImportance *= accountSummary.ActivitySummary.TotalFeesPaid.unwrap();
+			feeImportance *= activitySummary.TotalFeesPaid.unwrap();
 			feeImportance *= (importanceActivityPercentage * minHarvesterBalance.unwrap() * 8);
 			feeImportance /= context.TotalFeesPaid.unwrap() * 1'000;
-			feeImportance /= accountSummary.pAccountState->Balances.get(mosaicId).unwrap();
+			feeImportance /= balance.unwrap();
 		}
 
 		// 3. beneficiary count: importanceActivityPercentage * (minHarvesterBalance / stake) * 0.2 * beneficiaryCountPercentage
 		boost::multiprecision::uint128_t beneficiaryCountImportance(0);
 		if (0 < importanceActivityPercentage && 0u < context.TotalBeneficiaryCount) {
 			beneficiaryCountImportance = totalChainImportance.unwrap();
-			beneficiaryCountImportance *= accountSummary.ActivitySummary.BeneficiaryCount;
+			beneficiaryCountImportance *= activitySummary.BeneficiaryCount;
 			beneficiaryCountImportance *= (importanceActivityPercentage * minHarvesterBalance.unwrap() * 2);
 			beneficiaryCountImportance /= context.TotalBeneficiaryCount * 1'000;
-			beneficiaryCountImportance /= accountSummary.pAccountState->Balances.get(mosaicId).unwrap();
+			beneficiaryCountImportance /= balance.unwrap();
 		}
 
 		auto rawActivityImportance = static_cast<Importance::ValueType>(feeImportance + beneficiaryCountImportance);
-		accountSummary.ActivityImportance = Importance(rawActivityImportance);
+		return { Importance(static_cast<Importance::ValueType>(stakeImportance)), Importance(rawActivityImportance) };
+	}
+
+	void CalculateImportances(
+			AccountSummary& accountSummary,
+			const ImportanceCalculationContext& context,
+			const model::BlockChainConfiguration& config) {
+		auto balance = accountSummary.pAccountState->Balances.get(config.HarvestingMosaicId);
+		auto importances = CalculateImportances(balance, accountSummary.ActivitySummary, context, config);
+		accountSummary.StakeImportance = importances.StakeImportance;
+		accountSummary.ActivityImportance = importances.ActivityImportance;
 	}
 
 	// endregion
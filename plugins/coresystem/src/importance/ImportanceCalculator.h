@@ -59,6 +59,12 @@ namespace catapult { namespace importance {
 	/// Creates an importance calculator for the block chain described by \a config.
 	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(const model::BlockChainConfiguration& config);
 
+	/// Creates an importance calculator for the block chain described by \a config that uses at most \a maxWorkerThreads threads.
+	/// \note Threads are only used when there are enough high value accounts to split the calculation into multiple partitions.
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockChainConfiguration& config,
+			uint32_t maxWorkerThreads);
+
 	/// Creates a restore importance calculator.
 	std::unique_ptr<ImportanceCalculator> CreateRestoreImportanceCalculator();
 }}
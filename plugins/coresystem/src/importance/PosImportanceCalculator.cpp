@@ -25,17 +25,107 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/HeightGrouping.h"
 #include "catapult/state/AccountImportanceSnapshots.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
-#include <boost/multiprecision/cpp_int.hpp>
 #include <memory>
+#include <thread>
 #include <vector>
 
 namespace catapult { namespace importance {
 
 	namespace {
+		constexpr size_t Min_Accounts_Per_Partition = 1024;
+
+		// region AccountColumns
+
+		/// Columnar snapshot of the high value accounts participating in an importance calculation.
+		struct AccountColumns {
+		public:
+			explicit AccountColumns(size_t numAccounts)
+					: Balances(numAccounts)
+					, ActivitySummaries(numAccounts)
+					, Importances(numAccounts) {
+				AccountStates.reserve(numAccounts);
+			}
+
+		public:
+			/// Account states (used only for reading inputs and writing results).
+			std::vector<state::AccountState*> AccountStates;
+
+			/// Harvesting mosaic balances.
+			std::vector<Amount> Balances;
+
+			/// Activity summaries.
+			std::vector<AccountActivitySummary> ActivitySummaries;
+
+			/// Stake and activity importances.
+			std::vector<AccountImportances> Importances;
+		};
+
+		// endregion
+
+		// region PartitionedExecutor
+
+		/// Executes actions over contiguous account ranges, in parallel when there are enough accounts.
+		class PartitionedExecutor {
+		public:
+			PartitionedExecutor(size_t numAccounts, uint32_t maxWorkerThreads)
+					: m_numPartitions(std::max<size_t>(1, std::min<size_t>(maxWorkerThreads, numAccounts / Min_Accounts_Per_Partition))) {
+				if (1 == m_numPartitions)
+					return;
+
+				m_pPool = thread::CreateIoThreadPool(m_numPartitions, "importance");
+				m_pPool->start();
+			}
+
+		public:
+			size_t numPartitions() const {
+				return m_numPartitions;
+			}
+
+		public:
+			/// Calls \a action with the begin and end index and the partition index of each partition of \a accountStates.
+			template<typename TAction>
+			void run(const std::vector<state::AccountState*>& accountStates, TAction action) {
+				if (!m_pPool) {
+					action(0u, accountStates.size(), 0u);
+					return;
+				}
+
+				std::vector<std::exception_ptr> exceptions(m_numPartitions);
+				thread::ParallelForPartition(m_pPool->ioContext(), accountStates, m_numPartitions, [&action, &exceptions](
+						auto itBegin,
+						auto itEnd,
+						auto startIndex,
+						auto partitionIndex) {
+					try {
+						action(startIndex, startIndex + static_cast<size_t>(std::distance(itBegin, itEnd)), partitionIndex);
+					} catch (...) {
+						exceptions[partitionIndex] = std::current_exception();
+					}
+				}).get();
+
+				for (const auto& pException : exceptions) {
+					if (pException)
+						std::rethrow_exception(pException);
+				}
+			}
+
+		private:
+			size_t m_numPartitions;
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+		};
+
+		// endregion
+
+		// region PosImportanceCalculator
+
 		class PosImportanceCalculator final : public ImportanceCalculator {
 		public:
-			explicit PosImportanceCalculator(const model::BlockChainConfiguration& config) : m_config(config)
+			PosImportanceCalculator(const model::BlockChainConfiguration& config, uint32_t maxWorkerThreads)
+					: m_config(config)
+					, m_maxWorkerThreads(maxWorkerThreads)
 			{}
 
 		public:
@@ -46,74 +136,143 @@ namespace catapult { namespace importance {
 				utils::StackLogger stopwatch("PosImportanceCalculator::recalculate", utils::LogLevel::debug);
 
 				// 1. get high value accounts (notice two step lookup because only const iteration is supported)
+				//    lookups are serial because mutable delta lookups are not thread safe
 				const auto& highValueAccounts = cache.highValueAccounts();
 				const auto& highValueAddresses = highValueAccounts.addresses();
-				std::vector<AccountSummary> accountSummaries;
-				accountSummaries.reserve(highValueAddresses.size());
+				AccountColumns columns(highValueAddresses.size());
+				for (const auto& address : highValueAddresses)
+					columns.AccountStates.push_back(&cache.find(address).get());
+
+				PartitionedExecutor executor(columns.AccountStates.size(), m_maxWorkerThreads);
+
+				// 2. snapshot balances and activity and calculate sums
+				std::vector<ImportanceCalculationContext> partitionContexts(executor.numPartitions());
+				executor.run(columns.AccountStates, [this, importanceHeight, &columns, &partitionContexts](
+						auto beginIndex,
+						auto endIndex,
+						auto partitionIndex) {
+					snapshotAccounts(importanceHeight, columns, beginIndex, endIndex, partitionContexts[partitionIndex]);
+				});
 
-				// 2. calculate sums
-				auto importanceGrouping = m_config.ImportanceGrouping;
 				ImportanceCalculationContext context;
-				auto mosaicId = m_config.HarvestingMosaicId;
-				for (const auto& address : highValueAddresses) {
-					auto accountStateIter = cache.find(address);
-					auto& accountState = accountStateIter.get();
-					const auto& activityBuckets = accountState.ActivityBuckets;
-					auto accountActivitySummary = SummarizeAccountActivity(importanceHeight, importanceGrouping, activityBuckets);
-					accountSummaries.push_back(AccountSummary(accountActivitySummary, accountState));
-					context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + accountState.Balances.get(mosaicId);
-					context.TotalBeneficiaryCount += accountActivitySummary.BeneficiaryCount;
-					context.TotalFeesPaid = context.TotalFeesPaid + accountActivitySummary.TotalFeesPaid;
+				for (const auto& partitionContext : partitionContexts) {
+					context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + partitionContext.ActiveHarvestingMosaics;
+					context.TotalBeneficiaryCount += partitionContext.TotalBeneficiaryCount;
+					context.TotalFeesPaid = context.TotalFeesPaid + partitionContext.TotalFeesPaid;
 				}
 
 				// 3. calculate importance parts
+				std::vector<Importance> partitionActivityImportances(executor.numPartitions());
+				executor.run(columns.AccountStates, [this, &columns, &context, &partitionActivityImportances](
+						auto beginIndex,
+						auto endIndex,
+						auto partitionIndex) {
+					partitionActivityImportances[partitionIndex] = calculateImportances(columns, context, beginIndex, endIndex);
+				});
+
 				Importance totalActivityImportance;
-				for (auto& accountSummary : accountSummaries) {
-					CalculateImportances(accountSummary, context, m_config);
-					totalActivityImportance = totalActivityImportance + accountSummary.ActivityImportance;
-				}
+				for (auto partitionActivityImportance : partitionActivityImportances)
+					totalActivityImportance = totalActivityImportance + partitionActivityImportance;
 
-				// 4. calculate the final importance
-				auto targetActivityImportanceRaw = m_config.TotalChainImportance.unwrap() * m_config.ImportanceActivityPercentage / 100;
-				for (auto& accountSummary : accountSummaries) {
-					auto importance = calculateFinalImportance(accountSummary, totalActivityImportance, targetActivityImportanceRaw);
-					auto& accountState = *accountSummary.pAccountState;
-					FinalizeAccountActivity(importanceHeight, importance, accountState.ActivityBuckets);
-					auto effectiveImportance = model::ImportanceHeight(1) == importanceHeight
-							? importance
-							: Importance(std::min(importance.unwrap(), accountSummary.ActivitySummary.PreviousImportance.unwrap()));
-					accountSummary.pAccountState->ImportanceSnapshots.set(effectiveImportance, importanceHeight);
-				}
+				// 4. calculate the final importance (notice that each partition updates a disjoint set of accounts)
+				executor.run(columns.AccountStates, [this, importanceHeight, &columns, totalActivityImportance](
+						auto beginIndex,
+						auto endIndex,
+						auto) {
+					finalizeImportances(importanceHeight, columns, totalActivityImportance, beginIndex, endIndex);
+				});
 
 				CATAPULT_LOG(debug)
 						<< "recalculated importances (" << highValueAddresses.size() << " / " << cache.size() << " eligible)"
-						<< " at height " << importanceHeight;
+						<< " at height " << importanceHeight << " using " << executor.numPartitions() << " partitions";
 
 				// 5. disable collection of activity for the removed accounts
 				cache.processHighValueRemovedAccounts(importanceHeight);
 			}
 
 		private:
+			void snapshotAccounts(
+					model::ImportanceHeight importanceHeight,
+					AccountColumns& columns,
+					size_t beginIndex,
+					size_t endIndex,
+					ImportanceCalculationContext& context) const {
+				auto importanceGrouping = m_config.ImportanceGrouping;
+				auto mosaicId = m_config.HarvestingMosaicId;
+				for (auto i = beginIndex; i < endIndex; ++i) {
+					const auto& accountState = *columns.AccountStates[i];
+					auto& activitySummary = columns.ActivitySummaries[i];
+					activitySummary = SummarizeAccountActivity(importanceHeight, importanceGrouping, accountState.ActivityBuckets);
+					columns.Balances[i] = accountState.Balances.get(mosaicId);
+
+					context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + columns.Balances[i];
+					context.TotalBeneficiaryCount += activitySummary.BeneficiaryCount;
+					context.TotalFeesPaid = context.TotalFeesPaid + activitySummary.TotalFeesPaid;
+				}
+			}
+
+			Importance calculateImportances(
+					AccountColumns& columns,
+					const ImportanceCalculationContext& context,
+					size_t beginIndex,
+					size_t endIndex) const {
+				Importance activityImportance;
+				for (auto i = beginIndex; i < endIndex; ++i) {
+					columns.Importances[i] = CalculateImportances(columns.Balances[i], columns.ActivitySummaries[i], context, m_config);
+					activityImportance = activityImportance + columns.Importances[i].ActivityImportance;
+				}
+
+				return activityImportance;
+			}
+
+			void finalizeImportances(
+					model::ImportanceHeight importanceHeight,
+					const AccountColumns& columns,
+					Importance totalActivityImportance,
+					size_t beginIndex,
+					size_t endIndex) const {
+				auto targetActivityImportanceRaw = m_config.TotalChainImportance.unwrap() * m_config.ImportanceActivityPercentage / 100;
+				for (auto i = beginIndex; i < endIndex; ++i) {
+					const auto& importances = columns.Importances[i];
+					auto importance = calculateFinalImportance(importances, totalActivityImportance, targetActivityImportanceRaw);
+					auto& accountState = *columns.AccountStates[i];
+					FinalizeAccountActivity(importanceHeight, importance, accountState.ActivityBuckets);
+					auto effectiveImportance = model::ImportanceHeight(1) == importanceHeight
+							? importance
+							: Importance(std::min(importance.unwrap(), columns.ActivitySummaries[i].PreviousImportance.unwrap()));
+					accountState.ImportanceSnapshots.set(effectiveImportance, importanceHeight);
+				}
+			}
+
 			Importance calculateFinalImportance(
-					const AccountSummary& accountSummary,
+					const AccountImportances& importances,
 					Importance totalActivityImportance,
 					Importance::ValueType targetActivityImportanceRaw) const {
 				if (Importance() == totalActivityImportance) {
 					return 0 < m_config.ImportanceActivityPercentage
-							? Importance(accountSummary.StakeImportance.unwrap() * 100 / (100 - m_config.ImportanceActivityPercentage))
-							: accountSummary.StakeImportance;
+							? Importance(importances.StakeImportance.unwrap() * 100 / (100 - m_config.ImportanceActivityPercentage))
+							: importances.StakeImportance;
 				}
 
-				auto numerator = accountSummary.ActivityImportance.unwrap() * targetActivityImportanceRaw;
-				return accountSummary.StakeImportance + Importance(numerator / totalActivityImportance.unwrap());
+				auto numerator = importances.ActivityImportance.unwrap() * targetActivityImportanceRaw;
+				return importances.StakeImportance + Importance(numerator / totalActivityImportance.unwrap());
 			}
 
 		private:
 			const model::BlockChainConfiguration m_config;
+			uint32_t m_maxWorkerThreads;
 		};
+
+		// endregion
 	}
 
 	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(const model::BlockChainConfiguration& config) {
-		return std::make_unique<PosImportanceCalculator>(config);
+		return CreateImportanceCalculator(config, std::thread::hardware_concurrency());
+	}
+
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockChainConfiguration& config,
+			uint32_t maxWorkerThreads) {
+		return std::make_unique<PosImportanceCalculator>(config, maxWorkerThreads);
 	}
 }}
@@ -22,10 +22,12 @@
 #include "StorageImportanceCalculatorFactory.h"
 #include "catapult/cache/StateVersion.h"
 #include "catapult/cache_core/AccountStateCacheDelta.h"
+#include "catapult/io/BufferInputStreamAdapter.h"
 #include "catapult/io/FileStream.h"
 #include "catapult/io/IndexFile.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/state/AccountStateSerializer.h"
+#include <algorithm>
 
 namespace catapult { namespace importance {
 
@@ -49,7 +51,11 @@ namespace catapult { namespace importance {
 
 		struct PackedAccountEntry {
 		public:
-			static constexpr uint16_t State_Version = 1;
+			// version 1 files store one packed entry per account
+			static constexpr uint16_t Row_State_Version = 1;
+
+			// version 2 files store one column per field with each account group sorted by address
+			static constexpr uint16_t State_Version = 2;
 
 		public:
 			// corresponds to current importance height
@@ -65,6 +71,64 @@ namespace catapult { namespace importance {
 
 #pragma pack(pop)
 
+		// version, count and removed count
+		constexpr auto Header_Size = sizeof(uint16_t) + 2 * sizeof(uint64_t);
+
+		template<typename TValue, typename TAccessor>
+		void WriteColumn(io::OutputStream& output, const std::vector<PackedAccountEntry>& entries, TAccessor accessor) {
+			std::vector<TValue> column;
+			column.reserve(entries.size());
+			for (const auto& entry : entries)
+				column.push_back(accessor(entry));
+
+			output.write({ reinterpret_cast<const uint8_t*>(column.data()), column.size() * sizeof(TValue) });
+		}
+
+		void WriteColumns(io::OutputStream& output, const std::vector<PackedAccountEntry>& entries) {
+			// group fields needed for restoring importances before informational fields
+			WriteColumn<Address>(output, entries, [](const auto& entry) { return entry.Address; });
+			WriteColumn<Importance>(output, entries, [](const auto& entry) { return entry.Importance; });
+			WriteColumn<Amount>(output, entries, [](const auto& entry) { return entry.TotalFeesPaid; });
+			WriteColumn<uint32_t>(output, entries, [](const auto& entry) { return entry.BeneficiaryCount; });
+			WriteColumn<uint64_t>(output, entries, [](const auto& entry) { return entry.RawScore; });
+			WriteColumn<Amount>(output, entries, [](const auto& entry) { return entry.HarvestingBalance; });
+		}
+
+		template<typename TValue>
+		std::vector<TValue> ReadColumn(io::InputStream& input, size_t count) {
+			std::vector<TValue> column(count);
+			input.read({ reinterpret_cast<uint8_t*>(column.data()), count * sizeof(TValue) });
+			return column;
+		}
+
+		void ReadColumns(io::InputStream& input, size_t count, const consumer<const PackedAccountEntry&>& process) {
+			auto addresses = ReadColumn<Address>(input, count);
+			auto importances = ReadColumn<Importance>(input, count);
+			auto totalFeesPaid = ReadColumn<Amount>(input, count);
+			auto beneficiaryCounts = ReadColumn<uint32_t>(input, count);
+			auto rawScores = ReadColumn<uint64_t>(input, count);
+			auto harvestingBalances = ReadColumn<Amount>(input, count);
+
+			for (auto i = 0u; i < count; ++i) {
+				PackedAccountEntry entry;
+				entry.Address = addresses[i];
+				entry.HarvestingBalance = harvestingBalances[i];
+				entry.Importance = importances[i];
+				entry.TotalFeesPaid = totalFeesPaid[i];
+				entry.BeneficiaryCount = beneficiaryCounts[i];
+				entry.RawScore = rawScores[i];
+				process(entry);
+			}
+		}
+
+		void ReadRows(io::InputStream& input, size_t count, const consumer<const PackedAccountEntry&>& process) {
+			for (auto i = 0u; i < count; ++i) {
+				PackedAccountEntry entry;
+				input.read({ reinterpret_cast<uint8_t*>(&entry), sizeof(PackedAccountEntry) });
+				process(entry);
+			}
+		}
+
 		// endregion
 
 		// region WriteDecorator
@@ -98,26 +162,37 @@ namespace catapult { namespace importance {
 				auto filename = m_directory.file(GetFilename(importanceHeight));
 				CATAPULT_LOG(debug) << "writing importances to file " << filename << " for height " << importanceHeight;
 
+				const auto& highValueAccounts = cache.highValueAccounts();
+				std::vector<PackedAccountEntry> entries;
+				entries.reserve(highValueAccounts.addresses().size() + highValueAccounts.removedAddresses().size());
+				packAll(entries, cache, highValueAccounts.addresses());
+				packAll(entries, cache, highValueAccounts.removedAddresses());
+
 				io::FileStream output(io::RawFile(filename, io::OpenMode::Read_Write));
 				cache::StateVersion<PackedAccountEntry>::Write(output);
 
-				const auto& highValueAccounts = cache.highValueAccounts();
 				io::Write64(output, highValueAccounts.addresses().size());
 				io::Write64(output, highValueAccounts.removedAddresses().size());
-
-				writeAll(output, cache, highValueAccounts.addresses());
-				writeAll(output, cache, highValueAccounts.removedAddresses());
+				WriteColumns(output, entries);
 
 				io::IndexFile(m_directory.file(Index_Filename)).set(importanceHeight.unwrap());
 			}
 
-			void writeAll(io::OutputStream& output, const cache::AccountStateCacheDelta& cache, const model::AddressSet& addresses) const {
+			void packAll(
+					std::vector<PackedAccountEntry>& entries,
+					const cache::AccountStateCacheDelta& cache,
+					const model::AddressSet& addresses) const {
+				auto groupStartIndex = entries.size();
 				for (const auto& address : addresses) {
 					auto accountStateIter = cache.find(address);
-
-					auto entry = pack(accountStateIter.get());
-					output.write({ reinterpret_cast<const uint8_t*>(&entry), sizeof(PackedAccountEntry) });
+					entries.push_back(pack(accountStateIter.get()));
 				}
+
+				// sort each group by address so that file contents are deterministic
+				auto groupBeginIter = entries.begin() + static_cast<std::ptrdiff_t>(groupStartIndex);
+				std::sort(groupBeginIter, entries.end(), [](const auto& lhs, const auto& rhs) {
+					return lhs.Address < rhs.Address;
+				});
 			}
 
 			PackedAccountEntry pack(const state::AccountState& accountState) const {
@@ -260,17 +335,34 @@ namespace catapult { namespace importance {
 				auto filename = m_directory.file(GetFilename(importanceHeight));
 				CATAPULT_LOG(debug) << "restoring older importances from file " << filename << " for height " << importanceHeight;
 
-				io::FileStream input(io::RawFile(filename, io::OpenMode::Read_Only));
-				cache::StateVersion<PackedAccountEntry>::ReadAndCheck(input);
+				// load the entire file with a single read and deserialize it from memory
+				std::vector<uint8_t> buffer;
+				{
+					io::RawFile rawFile(filename, io::OpenMode::Read_Only);
+					buffer.resize(rawFile.size());
+					rawFile.read(buffer);
+				}
 
+				io::BufferInputStreamAdapter<std::vector<uint8_t>> input(buffer);
+				auto version = io::Read16(input);
 				auto count = io::Read64(input);
 				auto removedCount = io::Read64(input);
 
-				for (auto i = 0u; i < count + removedCount; ++i) {
-					PackedAccountEntry entry;
-					input.read({ reinterpret_cast<uint8_t*>(&entry), sizeof(PackedAccountEntry) });
-					process(entry);
-				}
+				if (PackedAccountEntry::State_Version != version && PackedAccountEntry::Row_State_Version != version)
+					CATAPULT_THROW_RUNTIME_ERROR_1("serialized state has invalid version", version);
+
+				// validate counts against file size before allocating any columns
+				auto numEntries = count + removedCount;
+				auto numEntriesBytes = buffer.size() - Header_Size;
+				auto hasExpectedSize = 0 == numEntriesBytes % sizeof(PackedAccountEntry)
+						&& numEntries == numEntriesBytes / sizeof(PackedAccountEntry);
+				if (numEntries < count || !hasExpectedSize)
+					CATAPULT_THROW_RUNTIME_ERROR_1("importance file has entry counts inconsistent with its size", filename);
+
+				if (PackedAccountEntry::State_Version == version)
+					ReadColumns(input, numEntries, process);
+				else
+					ReadRows(input, numEntries, process);
 			}
 
 		private:
@@ -68,6 +68,13 @@ namespace catapult { namespace importance {
 			Recalculate(calculator, importanceHeight, delta);
 		}
 
+		Key CreateAccountKey(uint32_t id) {
+			// notice that this is equivalent to Key{ { id } } for ids less than 256
+			Key key;
+			std::memcpy(key.data(), &id, sizeof(uint32_t));
+			return key;
+		}
+
 		struct AccountSeed {
 		public:
 			AccountSeed(catapult::Amount amount, const std::vector<state::AccountActivityBuckets::ActivityBucket>& buckets)
@@ -100,9 +107,9 @@ namespace catapult { namespace importance {
 
 		public:
 			void seedDelta(const std::vector<AccountSeed>& accountSeeds, model::ImportanceHeight importanceHeight) {
-				uint8_t i = 0;
+				uint32_t i = 0;
 				for (const auto& accountData : accountSeeds) {
-					auto key = Key{ { ++i } };
+					auto key = CreateAccountKey(++i);
 					delta().addAccount(key, Height(importanceHeight.unwrap()));
 					auto& accountState = get(key);
 					accountState.Balances.credit(Harvesting_Mosaic_Id, accountData.Amount);
@@ -600,4 +607,105 @@ namespace catapult { namespace importance {
 	}
 
 	// endregion
+
+	// region parallel calculation
+
+	namespace {
+		constexpr uint32_t Num_Many_Account_States = 5'000;
+
+		std::vector<AccountSeed> GenerateManyAccountSeeds(Amount minHarvesterBalance) {
+			std::vector<AccountSeed> accountSeeds;
+			for (auto i = 0u; i < Num_Many_Account_States; ++i) {
+				auto balance = minHarvesterBalance + Amount(test::Random() % 1'000'000'000);
+
+				std::vector<state::AccountActivityBuckets::ActivityBucket> buckets;
+				if (0 != i % 3) {
+					auto fees = Amount(test::Random() % 10'000);
+					auto beneficiaryCount = static_cast<uint32_t>(test::Random() % 100);
+					buckets.push_back(CreateActivityBucket(fees, beneficiaryCount, Recalculation_Height - model::ImportanceHeight(1)));
+				}
+
+				accountSeeds.emplace_back(balance, buckets);
+			}
+
+			return accountSeeds;
+		}
+
+		struct AccountImportanceResult {
+		public:
+			Importance CurrentImportance;
+			uint64_t RawScore;
+
+		public:
+			bool operator==(const AccountImportanceResult& rhs) const {
+				return CurrentImportance == rhs.CurrentImportance && RawScore == rhs.RawScore;
+			}
+		};
+
+		std::vector<AccountImportanceResult> RecalculateWithWorkerThreads(
+				const model::BlockChainConfiguration& config,
+				const std::vector<AccountSeed>& accountSeeds,
+				uint32_t maxWorkerThreads) {
+			// Arrange:
+			CacheHolder holder(config.MinHarvesterBalance);
+			holder.seedDelta(accountSeeds, model::ImportanceHeight(1));
+			auto pCalculator = CreateImportanceCalculator(config, maxWorkerThreads);
+
+			// Act:
+			RecalculateTwice(*pCalculator, Recalculation_Height, holder.delta());
+
+			// Assert:
+			std::vector<AccountImportanceResult> results;
+			for (auto i = 1u; i <= accountSeeds.size(); ++i) {
+				const auto& accountState = holder.get(CreateAccountKey(i));
+				const auto& bucket = accountState.ActivityBuckets.get(Recalculation_Height);
+				results.push_back({ accountState.ImportanceSnapshots.current(), bucket.RawScore });
+			}
+
+			return results;
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelCalculationIsDeterministicAndMatchesSingleThreadedCalculation) {
+		// Arrange: use a large total chain importance so that importances are distinct
+		auto config = CreateBlockChainConfiguration(10);
+		config.TotalChainImportance = Importance(9'000'000'000);
+		auto accountSeeds = GenerateManyAccountSeeds(config.MinHarvesterBalance);
+
+		// Act:
+		auto expectedResults = RecalculateWithWorkerThreads(config, accountSeeds, 1);
+
+		// Sanity: importances are nonzero and sum to total chain importance (with deviation of at most one per account)
+		Importance::ValueType sum = 0;
+		for (const auto& result : expectedResults) {
+			EXPECT_LT(Importance(), result.CurrentImportance);
+			sum += result.CurrentImportance.unwrap();
+		}
+
+		EXPECT_GE(Num_Many_Account_States, config.TotalChainImportance.unwrap() - sum);
+
+		// Assert: any partitioning produces identical results
+		for (auto maxWorkerThreads : { 2u, 3u, 4u, 16u }) {
+			for (auto j = 0u; j < 2; ++j) {
+				auto results = RecalculateWithWorkerThreads(config, accountSeeds, maxWorkerThreads);
+				EXPECT_TRUE(expectedResults == results) << "max worker threads " << maxWorkerThreads << " run " << j;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelCalculationPropagatesPartitionException) {
+		// Arrange: add a bucket after the recalculation height to one account, which will fail summarization in its partition
+		auto config = CreateBlockChainConfiguration(10);
+		auto accountSeeds = GenerateManyAccountSeeds(config.MinHarvesterBalance);
+		accountSeeds.back().Buckets.push_back(CreateActivityBucket(Amount(1), 1, Recalculation_Height + model::ImportanceHeight(1)));
+
+		CacheHolder holder(config.MinHarvesterBalance);
+		holder.seedDelta(accountSeeds, model::ImportanceHeight(1));
+		auto pCalculator = CreateImportanceCalculator(config, 4);
+
+		// Act + Assert:
+		EXPECT_THROW(Recalculate(*pCalculator, Recalculation_Height, holder.delta()), catapult_invalid_argument);
+	}
+
+	// endregion
 }}
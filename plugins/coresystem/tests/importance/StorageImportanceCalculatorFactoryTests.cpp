@@ -60,6 +60,11 @@ namespace catapult { namespace importance {
 			uint64_t RawScore;
 		};
 
+		struct AccountPart {
+			AccountHeader Header;
+			AccountImportanceSeed Seed;
+		};
+
 #pragma pack(pop)
 
 		// endregion
@@ -289,7 +294,7 @@ namespace catapult { namespace importance {
 				return std::filesystem::file_size(qualify(filename));
 			}
 
-			std::vector<uint8_t> readAll(const std::string& filename) {
+			std::vector<uint8_t> readAll(const std::string& filename) const {
 				io::RawFile rawFile(qualify(filename), io::OpenMode::Read_Only);
 
 				std::vector<uint8_t> contents(rawFile.size());
@@ -297,6 +302,18 @@ namespace catapult { namespace importance {
 				return contents;
 			}
 
+			void rewriteImportanceFiles(const std::function<std::vector<uint8_t> (const std::vector<uint8_t>&)>& transform) const {
+				for (const auto& entry : std::filesystem::directory_iterator(m_tempDir.name())) {
+					auto filename = entry.path().filename().generic_string();
+					if ("index.dat" == filename)
+						continue;
+
+					auto contents = transform(readAll(filename));
+					io::RawFile rawFile(qualify(filename), io::OpenMode::Read_Write);
+					rawFile.write(contents);
+				}
+			}
+
 		public:
 			void assertFiles(const std::unordered_set<std::string>& expectedFilenames) {
 				EXPECT_EQ(1 + expectedFilenames.size(), test::CountFilesAndDirectories(m_tempDir.name()));
@@ -344,51 +361,90 @@ namespace catapult { namespace importance {
 
 		// region FileContentsBuilder
 
-		class FileContentsBuilder {
-		private:
-			static constexpr auto Account_Part_Size = sizeof(AccountHeader) + sizeof(AccountImportanceSeed);
+		template<typename TValue, typename TAccessor>
+		void AppendColumn(std::vector<uint8_t>& buffer, const std::vector<AccountPart>& parts, TAccessor accessor) {
+			for (const auto& part : parts) {
+				auto value = accessor(part);
+				auto offset = buffer.size();
+				buffer.resize(offset + sizeof(TValue));
+				std::memcpy(&buffer[offset], &value, sizeof(TValue));
+			}
+		}
 
+		class FileContentsBuilder {
 		public:
-			explicit FileContentsBuilder(const FileHeader& header) {
-				m_buffer.resize(sizeof(FileHeader));
-				std::memcpy(&m_buffer[0], &header, sizeof(FileHeader));
-			}
+			explicit FileContentsBuilder(const FileHeader& header) : m_header(header)
+			{}
 
 		public:
 			void append(const AccountHeader& header, const AccountImportanceSeed& seed) {
-				auto offset = m_buffer.size();
-				m_buffer.resize(offset + sizeof(AccountHeader) + sizeof(AccountImportanceSeed));
-				std::memcpy(&m_buffer[offset], &header, sizeof(AccountHeader));
-				std::memcpy(&m_buffer[offset + sizeof(AccountHeader)], &seed, sizeof(AccountImportanceSeed));
+				m_parts.push_back({ header, seed });
 			}
 
 		public:
 			void assertContents(const std::vector<uint8_t>& actual) const {
-				// Assert:
-				ASSERT_EQ(m_buffer.size(), actual.size());
-
-				// - check header
-				FileHeader header;
-				std::memcpy(&header, &m_buffer[0], sizeof(FileHeader));
+				// Assert: addresses and removed addresses are each sorted and then serialized column by column
+				auto expected = build();
+				ASSERT_EQ(expected.size(), actual.size());
+				EXPECT_EQ_MEMORY(&expected[0], &actual[0], expected.size());
+			}
 
-				EXPECT_EQ_MEMORY(&header, &actual[0], sizeof(FileHeader));
+		private:
+			std::vector<uint8_t> build() const {
+				auto parts = m_parts;
+				auto sortByAddress = [](const auto& lhs, const auto& rhs) { return lhs.Header.Address < rhs.Header.Address; };
+				auto removedBeginIter = parts.begin() + static_cast<std::ptrdiff_t>(m_header.Count);
+				std::sort(parts.begin(), removedBeginIter, sortByAddress);
+				std::sort(removedBeginIter, parts.end(), sortByAddress);
+
+				std::vector<uint8_t> buffer(sizeof(FileHeader));
+				std::memcpy(&buffer[0], &m_header, sizeof(FileHeader));
+
+				AppendColumn<Address>(buffer, parts, [](const auto& part) { return part.Header.Address; });
+				AppendColumn<Importance>(buffer, parts, [](const auto& part) { return part.Seed.Importance; });
+				AppendColumn<Amount>(buffer, parts, [](const auto& part) { return part.Seed.TotalFeesPaid; });
+				AppendColumn<uint32_t>(buffer, parts, [](const auto& part) { return part.Seed.BeneficiaryCount; });
+				AppendColumn<uint64_t>(buffer, parts, [](const auto& part) { return part.Seed.RawScore; });
+				AppendColumn<Amount>(buffer, parts, [](const auto& part) { return part.Header.Balance; });
+				return buffer;
+			}
 
-				// - check importance entries (can be out of order)
-				std::set<std::vector<uint8_t>> expectedSplitAccountParts;
-				std::set<std::vector<uint8_t>> actualSplitAccountParts;
+		private:
+			FileHeader m_header;
+			std::vector<AccountPart> m_parts;
+		};
 
-				auto offset = sizeof(FileHeader);
-				for (auto i = 0u; i < header.Count + header.RemovedCount; ++i, offset += Account_Part_Size) {
-					expectedSplitAccountParts.emplace(&m_buffer[offset], &m_buffer[offset] + Account_Part_Size);
-					actualSplitAccountParts.emplace(&actual[offset], &actual[offset] + Account_Part_Size);
+		std::vector<uint8_t> ConvertToRowFormat(const std::vector<uint8_t>& columnarContents) {
+			FileHeader header;
+			std::memcpy(&header, &columnarContents[0], sizeof(FileHeader));
+			auto count = header.Count + header.RemovedCount;
+
+			std::vector<AccountPart> parts(count);
+			auto offset = sizeof(FileHeader);
+			auto readColumn = [&columnarContents, &parts, &offset](auto accessor) {
+				for (auto& part : parts) {
+					auto& value = accessor(part);
+					std::memcpy(reinterpret_cast<uint8_t*>(&value), &columnarContents[offset], sizeof(value));
+					offset += sizeof(value);
 				}
+			};
 
-				EXPECT_EQ(expectedSplitAccountParts, actualSplitAccountParts);
-			}
+			readColumn([](auto& part) -> auto& { return part.Header.Address; });
+			readColumn([](auto& part) -> auto& { return part.Seed.Importance; });
+			readColumn([](auto& part) -> auto& { return part.Seed.TotalFeesPaid; });
+			readColumn([](auto& part) -> auto& { return part.Seed.BeneficiaryCount; });
+			readColumn([](auto& part) -> auto& { return part.Seed.RawScore; });
+			readColumn([](auto& part) -> auto& { return part.Header.Balance; });
 
-		private:
-			std::vector<uint8_t> m_buffer;
-		};
+			// Sanity:
+			EXPECT_EQ(columnarContents.size(), offset);
+
+			header.Version = 1;
+			std::vector<uint8_t> rowContents(sizeof(FileHeader) + count * sizeof(AccountPart));
+			std::memcpy(&rowContents[0], &header, sizeof(FileHeader));
+			std::memcpy(&rowContents[sizeof(FileHeader)], parts.data(), count * sizeof(AccountPart));
+			return rowContents;
+		}
 
 		// endregion
 	}
@@ -464,7 +520,7 @@ namespace catapult { namespace importance {
 		EXPECT_EQ(Importance_Height.unwrap(), context.loadIndexValue());
 		context.assertFiles({ Importance_Filename });
 
-		FileContentsBuilder contentsBuilder({ 1, 3, 0 });
+		FileContentsBuilder contentsBuilder({ 2, 3, 0 });
 		contentsBuilder.append({ addresses[0], Amount(2000) }, { Importance(111), Amount(222), 14, 400 });
 		contentsBuilder.append({ addresses[1], Amount(1000) }, { Importance(123), Amount(432), 22, 200 });
 		contentsBuilder.append({ addresses[2], Amount(3000) }, { Importance(444), Amount(110), 10, 300 });
@@ -500,7 +556,7 @@ namespace catapult { namespace importance {
 		EXPECT_EQ(Importance_Height.unwrap(), context.loadIndexValue());
 		context.assertFiles({ Importance_Filename });
 
-		FileContentsBuilder contentsBuilder({ 1, 3, 2 });
+		FileContentsBuilder contentsBuilder({ 2, 3, 2 });
 		contentsBuilder.append({ addresses[0], Amount(2000) }, { Importance(111), Amount(222), 14, 400 });
 		contentsBuilder.append({ addresses[1], Amount(1000) }, { Importance(123), Amount(432), 22, 200 });
 		contentsBuilder.append({ addresses[2], Amount(3000) }, { Importance(444), Amount(110), 10, 300 });
@@ -541,7 +597,7 @@ namespace catapult { namespace importance {
 		EXPECT_EQ(Importance_Height.unwrap(), context.loadIndexValue());
 		context.assertFiles({ Importance_Filename });
 
-		FileContentsBuilder contentsBuilder({ 1, 4, 0 });
+		FileContentsBuilder contentsBuilder({ 2, 4, 0 });
 		contentsBuilder.append({ addresses1[0], Amount(2000) }, { Importance(111), Amount(222), 14, 400 });
 		contentsBuilder.append({ addresses1[1], Amount(1000) }, { Importance(123), Amount(432), 22, 200 });
 		contentsBuilder.append({ addresses1[2], Amount(3000) }, { Importance(444), Amount(110), 10, 300 });
@@ -690,6 +746,7 @@ namespace catapult { namespace importance {
 		struct MinimumAccountsTraits {
 		public:
 			static constexpr auto Should_Seed_Additional_Accounts = false;
+			static constexpr auto Should_Use_Row_Format = false;
 
 		public:
 			class CacheHolderFactory {
@@ -720,6 +777,7 @@ namespace catapult { namespace importance {
 		struct AdditionalAccountsTraits {
 		public:
 			static constexpr auto Should_Seed_Additional_Accounts = true;
+			static constexpr auto Should_Use_Row_Format = false;
 
 		public:
 			class CacheHolderFactory {
@@ -753,6 +811,11 @@ namespace catapult { namespace importance {
 			};
 		};
 
+		struct AdditionalAccountsRowFormatTraits : public AdditionalAccountsTraits {
+		public:
+			static constexpr auto Should_Use_Row_Format = true;
+		};
+
 		void ToggleBalance(state::AccountState& accountState, bool enable) {
 			auto currentBalance = accountState.Balances.get(Harvesting_Mosaic_Id);
 			if (enable) {
@@ -802,6 +865,10 @@ namespace catapult { namespace importance {
 				pCalculator->recalculate(Default_Calculation_Mode, model::ImportanceHeight(height), delta);
 			}
 
+			// - simulate files written by an older version
+			if (TTraits::Should_Use_Row_Format)
+				context.rewriteImportanceFiles(ConvertToRowFormat);
+
 			// -  limit the highValueAccounts to the three relevant accounts
 			action(addresses, context, holderFactory.restoreHolder());
 		}
@@ -917,5 +984,75 @@ namespace catapult { namespace importance {
 		AssertCanRoundtripToNemesis<AdditionalAccountsTraits>();
 	}
 
+	TEST(TEST_CLASS, CanRoundtripToPointAfterNemesisFromRowFormatImportanceFiles) {
+		AssertCanRoundtripToPointAfterNemesis<AdditionalAccountsRowFormatTraits>();
+	}
+
+	TEST(TEST_CLASS, CanRoundtripToNemesisFromRowFormatImportanceFiles) {
+		AssertCanRoundtripToNemesis<AdditionalAccountsRowFormatTraits>();
+	}
+
+	namespace {
+		void AssertCannotRoundtripCorruptImportanceFiles(const std::function<void (std::vector<uint8_t>&)>& corrupt) {
+			// Arrange:
+			PrepareRollbackTest<MinimumAccountsTraits>([&corrupt](const auto&, const auto& context, auto& holder) {
+				context.rewriteImportanceFiles([&corrupt](const auto& contents) {
+					auto corruptContents = contents;
+					corrupt(corruptContents);
+					return corruptContents;
+				});
+
+				// Act + Assert:
+				auto pCalculator = context.createReadCalculator({});
+				EXPECT_THROW(
+						pCalculator->recalculate(Default_Calculation_Mode, model::ImportanceHeight(615), holder.get()),
+						catapult_runtime_error);
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, CannotRoundtripImportanceFilesWithUnknownVersion) {
+		AssertCannotRoundtripCorruptImportanceFiles([](auto& contents) {
+			contents[0] = 3;
+		});
+	}
+
+	TEST(TEST_CLASS, CannotRoundtripImportanceFilesWithMissingData) {
+		AssertCannotRoundtripCorruptImportanceFiles([](auto& contents) {
+			contents.pop_back();
+		});
+	}
+
+	TEST(TEST_CLASS, CannotRoundtripImportanceFilesWithTrailingData) {
+		AssertCannotRoundtripCorruptImportanceFiles([](auto& contents) {
+			contents.push_back(0);
+		});
+	}
+
+	namespace {
+		constexpr auto Count_Offset = sizeof(uint16_t);
+		constexpr auto Removed_Count_Offset = Count_Offset + sizeof(uint64_t);
+
+		uint64_t& GetCount(std::vector<uint8_t>& contents, size_t offset) {
+			return reinterpret_cast<uint64_t&>(contents[offset]);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotRoundtripImportanceFilesWithCorruptCount) {
+		AssertCannotRoundtripCorruptImportanceFiles([](auto& contents) {
+			// count is much larger than the number of entries in the file
+			GetCount(contents, Count_Offset) = std::numeric_limits<uint64_t>::max() / 2;
+		});
+	}
+
+	TEST(TEST_CLASS, CannotRoundtripImportanceFilesWithOverflowingCounts) {
+		AssertCannotRoundtripCorruptImportanceFiles([](auto& contents) {
+			// sum of counts wraps around to the number of entries in the file
+			auto numEntries = GetCount(contents, Count_Offset) + GetCount(contents, Removed_Count_Offset);
+			GetCount(contents, Count_Offset) = std::numeric_limits<uint64_t>::max();
+			GetCount(contents, Removed_Count_Offset) = numEntries + 1;
+		});
+	}
+
 	// endregion
 }}
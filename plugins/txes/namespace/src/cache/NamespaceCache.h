@@ -31,23 +31,30 @@ namespace catapult { namespace cache {
 		NamespaceCacheDescriptor,
 		NamespaceCacheTypes::BaseSets,
 		NamespaceCacheTypes::Options,
-		const NamespaceSizes&>;
+		const NamespaceSizes&,
+		NamespaceAliasLookupCounters&>;
 
 	/// Cache composed of namespace information.
 	class BasicNamespaceCache : public NamespaceBasicCache {
 	public:
 		/// Creates a cache around \a config and \a options.
 		BasicNamespaceCache(const CacheConfiguration& config, const NamespaceCacheTypes::Options& options)
-				: BasicNamespaceCache(config, options, std::make_unique<NamespaceSizes>())
+				: BasicNamespaceCache(
+						config,
+						options,
+						std::make_unique<NamespaceSizes>(),
+						std::make_unique<NamespaceAliasLookupCounters>())
 		{}
 
 	private:
 		BasicNamespaceCache(
 				const CacheConfiguration& config,
 				const NamespaceCacheTypes::Options& options,
-				std::unique_ptr<NamespaceSizes>&& pSizes)
-				: NamespaceBasicCache(config, NamespaceCacheTypes::Options(options), *pSizes)
+				std::unique_ptr<NamespaceSizes>&& pSizes,
+				std::unique_ptr<NamespaceAliasLookupCounters>&& pAliasLookupCounters)
+				: NamespaceBasicCache(config, NamespaceCacheTypes::Options(options), *pSizes, *pAliasLookupCounters)
 				, m_pSizes(std::move(pSizes))
+				, m_pAliasLookupCounters(std::move(pAliasLookupCounters))
 		{}
 
 	public:
@@ -64,8 +71,9 @@ namespace catapult { namespace cache {
 		}
 
 	private:
-		// unique pointer to allow reference to be valid after moves of this cache
+		// unique pointers to allow references to be valid after moves of this cache
 		std::unique_ptr<NamespaceSizes> m_pSizes;
+		std::unique_ptr<NamespaceAliasLookupCounters> m_pAliasLookupCounters;
 	};
 
 	/// Synchronized cache composed of namespace information.
@@ -44,7 +44,8 @@ namespace catapult { namespace cache {
 	BasicNamespaceCacheDelta::BasicNamespaceCacheDelta(
 				const NamespaceCacheTypes::BaseSetDeltaPointers& namespaceSets,
 				const NamespaceCacheTypes::Options& options,
-				const NamespaceSizes& namespaceSizes)
+				const NamespaceSizes& namespaceSizes,
+				NamespaceAliasLookupCounters& aliasLookupCounters)
 			: NamespaceCacheDeltaMixins::Size(*namespaceSets.pPrimary)
 			, NamespaceCacheDeltaMixins::Contains(*namespaceSets.pFlatMap)
 			, NamespaceCacheDeltaMixins::PatriciaTreeDelta(*namespaceSets.pPrimary, namespaceSets.pPatriciaTree)
@@ -56,13 +57,35 @@ namespace catapult { namespace cache {
 			, m_pNamespaceById(namespaceSets.pFlatMap)
 			, m_pRootNamespaceIdsByExpiryHeight(namespaceSets.pHeightGrouping)
 			, m_gracePeriodDuration(options.GracePeriodDuration)
+			, m_aliasLookupCounters(aliasLookupCounters)
+			, m_pAliasMemo(std::make_unique<AliasMemo>())
 	{}
 
 	BlockDuration BasicNamespaceCacheDelta::gracePeriodDuration() const {
 		return m_gracePeriodDuration;
 	}
 
+	state::NamespaceAlias BasicNamespaceCacheDelta::findAlias(NamespaceId id) const {
+		{
+			utils::SpinLockGuard guard(m_pAliasMemo->Lock);
+			auto iter = m_pAliasMemo->Aliases.find(id);
+			if (m_pAliasMemo->Aliases.cend() != iter) {
+				++m_aliasLookupCounters.NumHits;
+				return iter->second;
+			}
+		}
+
+		++m_aliasLookupCounters.NumMisses;
+		auto alias = NamespaceCacheDeltaMixins::NamespaceLookup::findAlias(id);
+
+		utils::SpinLockGuard guard(m_pAliasMemo->Lock);
+		m_pAliasMemo->Aliases.emplace(id, alias);
+		return alias;
+	}
+
 	void BasicNamespaceCacheDelta::insert(const state::RootNamespace& ns) {
+		clearAliasMemo();
+
 		// register the namespace for expiration at the end of its lifetime (if its lifetime changes later, it will not be pruned)
 		AddIdentifierWithGroup(*m_pRootNamespaceIdsByExpiryHeight, ns.lifetime().End, ns.id());
 
@@ -95,6 +118,8 @@ namespace catapult { namespace cache {
 	}
 
 	void BasicNamespaceCacheDelta::insert(const state::Namespace& ns) {
+		clearAliasMemo();
+
 		auto historyIter = m_pHistoryById->find(ns.rootId());
 		auto* pHistory = historyIter.get();
 		if (!pHistory)
@@ -108,6 +133,8 @@ namespace catapult { namespace cache {
 	}
 
 	void BasicNamespaceCacheDelta::setAlias(NamespaceId id, const state::NamespaceAlias& alias) {
+		clearAliasMemo();
+
 		auto namespaceIter = m_pNamespaceById->find(id);
 		const auto* pNamespace = namespaceIter.get();
 		if (!pNamespace)
@@ -119,6 +146,8 @@ namespace catapult { namespace cache {
 	}
 
 	void BasicNamespaceCacheDelta::remove(NamespaceId id) {
+		clearAliasMemo();
+
 		auto namespaceIter = m_pNamespaceById->find(id);
 		const auto* pNamespace = namespaceIter.get();
 		if (!pNamespace)
@@ -191,6 +220,8 @@ namespace catapult { namespace cache {
 		BasicNamespaceCacheDelta::CollectedIds collectedIds;
 		const auto& heightGroupedSet = *m_pRootNamespaceIdsByExpiryHeight;
 		ForEachIdentifierWithGroup(*m_pHistoryById, heightGroupedSet, height, [this, height, &collectedIds](auto& history) {
+			clearAliasMemo();
+
 			auto originalSizes = GetNamespaceSizes(history);
 			auto removedIds = history.prune(height);
 			auto newSizes = GetNamespaceSizes(history);
@@ -208,4 +239,9 @@ namespace catapult { namespace cache {
 
 		return collectedIds;
 	}
+
+	void BasicNamespaceCacheDelta::clearAliasMemo() {
+		utils::SpinLockGuard guard(m_pAliasMemo->Lock);
+		m_pAliasMemo->Aliases.clear();
+	}
 }}
@@ -26,6 +26,8 @@
 #include "ReadOnlyNamespaceCache.h"
 #include "catapult/cache/CacheMixinAliases.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
+#include "catapult/utils/SpinLock.h"
+#include <unordered_map>
 
 namespace catapult { namespace cache {
 
@@ -65,16 +67,21 @@ namespace catapult { namespace cache {
 		using CollectedIds = std::unordered_set<NamespaceId, utils::BaseValueHasher<NamespaceId>>;
 
 	public:
-		/// Creates a delta around \a namespaceSets, \a options and \a namespaceSizes.
+		/// Creates a delta around \a namespaceSets, \a options, \a namespaceSizes and \a aliasLookupCounters.
 		BasicNamespaceCacheDelta(
 				const NamespaceCacheTypes::BaseSetDeltaPointers& namespaceSets,
 				const NamespaceCacheTypes::Options& options,
-				const NamespaceSizes& namespaceSizes);
+				const NamespaceSizes& namespaceSizes,
+				NamespaceAliasLookupCounters& aliasLookupCounters);
 
 	public:
 		/// Gets the grace period duration.
 		BlockDuration gracePeriodDuration() const;
 
+		/// Finds the alias associated with namespace \a id or an empty alias if the namespace is unknown.
+		/// \note Results are memoized until the next namespace change made through this delta.
+		state::NamespaceAlias findAlias(NamespaceId id) const;
+
 	public:
 		/// Inserts the root namespace \a ns into the cache.
 		void insert(const state::RootNamespace& ns);
@@ -95,22 +102,33 @@ namespace catapult { namespace cache {
 		void removeRoot(NamespaceId id);
 		void removeChild(const state::Namespace& ns);
 
+		void clearAliasMemo();
+
+	private:
+		struct AliasMemo {
+			utils::SpinLock Lock;
+			std::unordered_map<NamespaceId, state::NamespaceAlias, utils::BaseValueHasher<NamespaceId>> Aliases;
+		};
+
 	private:
 		NamespaceCacheTypes::PrimaryTypes::BaseSetDeltaPointerType m_pHistoryById;
 		NamespaceCacheTypes::NamespaceCacheTypes::FlatMapTypes::BaseSetDeltaPointerType m_pNamespaceById;
 		NamespaceCacheTypes::HeightGroupingTypes::BaseSetDeltaPointerType m_pRootNamespaceIdsByExpiryHeight;
 		BlockDuration m_gracePeriodDuration;
+		NamespaceAliasLookupCounters& m_aliasLookupCounters;
+		std::unique_ptr<AliasMemo> m_pAliasMemo; // unique pointer to allow delta to be moved
 	};
 
 	/// Delta on top of the namespace cache.
 	class NamespaceCacheDelta : public ReadOnlyViewSupplier<BasicNamespaceCacheDelta> {
 	public:
-		/// Creates a delta around \a namespaceSets, \a options and \a namespaceSizes.
+		/// Creates a delta around \a namespaceSets, \a options, \a namespaceSizes and \a aliasLookupCounters.
 		NamespaceCacheDelta(
 				const NamespaceCacheTypes::BaseSetDeltaPointers& namespaceSets,
 				const NamespaceCacheTypes::Options& options,
-				const NamespaceSizes& namespaceSizes)
-				: ReadOnlyViewSupplier(namespaceSets, options, namespaceSizes)
+				const NamespaceSizes& namespaceSizes,
+				NamespaceAliasLookupCounters& aliasLookupCounters)
+				: ReadOnlyViewSupplier(namespaceSets, options, namespaceSizes, aliasLookupCounters)
 		{}
 	};
 }}
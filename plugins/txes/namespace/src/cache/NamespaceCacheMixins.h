@@ -23,6 +23,7 @@
 #include "src/state/NamespaceEntry.h"
 #include "src/state/RootNamespaceHistory.h"
 #include "catapult/deltaset/BaseSetDelta.h"
+#include <atomic>
 #include <numeric>
 
 namespace catapult { namespace cache {
@@ -36,6 +37,15 @@ namespace catapult { namespace cache {
 		size_t Deep;
 	};
 
+	/// Counters of namespace alias lookups made through cache deltas.
+	struct NamespaceAliasLookupCounters {
+		/// Number of lookups answered by a delta alias memo.
+		std::atomic<uint64_t> NumHits{ 0 };
+
+		/// Number of lookups that required a namespace lookup.
+		std::atomic<uint64_t> NumMisses{ 0 };
+	};
+
 	/// Mixin for calculating the deep size of namespaces.
 	class NamespaceDeepSizeMixin {
 	public:
@@ -151,6 +161,12 @@ namespace catapult { namespace cache {
 			return const_iterator(std::move(namespaceIter), std::move(rootIter));
 		}
 
+		/// Finds the alias associated with namespace \a id or an empty alias if the namespace is unknown.
+		state::NamespaceAlias findAlias(NamespaceId id) const {
+			auto iter = find(id);
+			return iter.tryGet() ? iter.get().root().alias(id) : state::NamespaceAlias();
+		}
+
 	private:
 		const TPrimarySet& m_set;
 		const TFlatMap& m_flatMap;
@@ -60,11 +60,12 @@ namespace catapult { namespace cache {
 		using ReadOnlyView = NamespaceCacheTypes::CacheReadOnlyType;
 
 	public:
-		/// Creates a view around \a namespaceSets, \a options and \a namespaceSizes.
+		/// Creates a view around \a namespaceSets, \a options, \a namespaceSizes and \a aliasLookupCounters.
 		BasicNamespaceCacheView(
 				const NamespaceCacheTypes::BaseSets& namespaceSets,
 				const NamespaceCacheTypes::Options& options,
-				const NamespaceSizes& namespaceSizes)
+				const NamespaceSizes& namespaceSizes,
+				const NamespaceAliasLookupCounters& aliasLookupCounters)
 				: NamespaceCacheViewMixins::Size(namespaceSets.Primary)
 				, NamespaceCacheViewMixins::Contains(namespaceSets.FlatMap)
 				, NamespaceCacheViewMixins::Iteration(namespaceSets.Primary)
@@ -72,6 +73,7 @@ namespace catapult { namespace cache {
 				, NamespaceCacheViewMixins::NamespaceDeepSize(namespaceSizes)
 				, NamespaceCacheViewMixins::NamespaceLookup(namespaceSets.Primary, namespaceSets.FlatMap)
 				, m_gracePeriodDuration(options.GracePeriodDuration)
+				, m_aliasLookupCounters(aliasLookupCounters)
 		{}
 
 	public:
@@ -80,19 +82,26 @@ namespace catapult { namespace cache {
 			return m_gracePeriodDuration;
 		}
 
+		/// Gets the counters of alias lookups made through deltas of this cache.
+		const NamespaceAliasLookupCounters& aliasLookupCounters() const {
+			return m_aliasLookupCounters;
+		}
+
 	private:
 		BlockDuration m_gracePeriodDuration;
+		const NamespaceAliasLookupCounters& m_aliasLookupCounters;
 	};
 
 	/// View on top of the namespace cache.
 	class NamespaceCacheView : public ReadOnlyViewSupplier<BasicNamespaceCacheView> {
 	public:
-		/// Creates a view around \a namespaceSets, \a options and \a namespaceSizes.
+		/// Creates a view around \a namespaceSets, \a options, \a namespaceSizes and \a aliasLookupCounters.
 		NamespaceCacheView(
 				const NamespaceCacheTypes::BaseSets& namespaceSets,
 				const NamespaceCacheTypes::Options& options,
-				const NamespaceSizes& namespaceSizes)
-				: ReadOnlyViewSupplier(namespaceSets, options, namespaceSizes)
+				const NamespaceSizes& namespaceSizes,
+				const NamespaceAliasLookupCounters& aliasLookupCounters)
+				: ReadOnlyViewSupplier(namespaceSets, options, namespaceSizes, aliasLookupCounters)
 		{}
 	};
 }}
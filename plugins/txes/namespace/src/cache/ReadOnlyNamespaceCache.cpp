@@ -40,4 +40,8 @@ namespace catapult { namespace cache {
 	BlockDuration ReadOnlyNamespaceCache::gracePeriodDuration() const {
 		return m_pCache ? m_pCache->gracePeriodDuration() : m_pCacheDelta->gracePeriodDuration();
 	}
+
+	state::NamespaceAlias ReadOnlyNamespaceCache::findAlias(NamespaceId id) const {
+		return m_pCache ? m_pCache->findAlias(id) : m_pCacheDelta->findAlias(id);
+	}
 }}
@@ -51,6 +51,9 @@ namespace catapult { namespace cache {
 		/// Gets the grace period duration.
 		BlockDuration gracePeriodDuration() const;
 
+		/// Finds the alias associated with namespace \a id or an empty alias if the namespace is unknown.
+		state::NamespaceAlias findAlias(NamespaceId id) const;
+
 	private:
 		const BasicNamespaceCacheView* m_pCache;
 		const BasicNamespaceCacheDelta* m_pCacheDelta;
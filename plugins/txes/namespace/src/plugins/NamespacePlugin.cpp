@@ -89,11 +89,7 @@ namespace catapult { namespace plugins {
 				state::AliasType aliasType,
 				TAliasValue& aliasValue,
 				TAliasValueAccessor aliasValueAccessor) {
-			auto iter = namespaceCache.find(namespaceId);
-			if (!iter.tryGet())
-				return false;
-
-			const auto& alias = iter.get().root().alias(namespaceId);
+			auto alias = namespaceCache.findAlias(namespaceId);
 			if (aliasType != alias.type())
 				return false;
 
@@ -165,6 +161,12 @@ namespace catapult { namespace plugins {
 				counters.emplace_back(utils::DiagnosticCounterId("NS C"), [&cache]() { return GetNamespaceView(cache)->size(); });
 				counters.emplace_back(utils::DiagnosticCounterId("NS C AS"), [&cache]() { return GetNamespaceView(cache)->activeSize(); });
 				counters.emplace_back(utils::DiagnosticCounterId("NS C DS"), [&cache]() { return GetNamespaceView(cache)->deepSize(); });
+				counters.emplace_back(utils::DiagnosticCounterId("NS C AL HIT"), [&cache]() {
+					return GetNamespaceView(cache)->aliasLookupCounters().NumHits.load();
+				});
+				counters.emplace_back(utils::DiagnosticCounterId("NS C AL MISS"), [&cache]() {
+					return GetNamespaceView(cache)->aliasLookupCounters().NumMisses.load();
+				});
 			});
 
 			manager.addStatelessValidatorHook([config, minDuration, maxDuration](auto& builder) {
@@ -36,7 +36,7 @@ namespace catapult { namespace state {
 			: m_id(id)
 			, m_ownerAddress(ownerAddress)
 			, m_lifetime(lifetime)
-			, m_pChildren(pChildren)
+			, m_pSharedChildren(std::make_shared<SharedChildren>(SharedChildren{ pChildren }))
 	{}
 
 	NamespaceId RootNamespace::id() const {
@@ -44,7 +44,7 @@ namespace catapult { namespace state {
 	}
 
 	const RootNamespace::Children& RootNamespace::children() const {
-		return *m_pChildren;
+		return *m_pSharedChildren->pChildren;
 	}
 
 	const Address& RootNamespace::ownerAddress() const {
@@ -56,16 +56,17 @@ namespace catapult { namespace state {
 	}
 
 	bool RootNamespace::empty() const {
-		return m_pChildren->empty();
+		return children().empty();
 	}
 
 	size_t RootNamespace::size() const {
-		return m_pChildren->size();
+		return children().size();
 	}
 
 	Namespace RootNamespace::child(NamespaceId id) const {
-		auto iter = m_pChildren->find(id);
-		if (m_pChildren->cend() == iter)
+		const auto& rootChildren = children();
+		auto iter = rootChildren.find(id);
+		if (rootChildren.cend() == iter)
 			CATAPULT_THROW_INVALID_ARGUMENT_1("unknown child namespace (id) ", id);
 
 		return Namespace(iter->second.Path);
@@ -76,8 +77,9 @@ namespace catapult { namespace state {
 		if (m_id == id)
 			return m_alias;
 
-		auto iter = m_pChildren->find(id);
-		if (m_pChildren->cend() == iter)
+		const auto& rootChildren = children();
+		auto iter = rootChildren.find(id);
+		if (rootChildren.cend() == iter)
 			CATAPULT_THROW_INVALID_ARGUMENT_1("unknown child namespace (id) ", id);
 
 		return iter->second.Alias;
@@ -85,13 +87,14 @@ namespace catapult { namespace state {
 
 	void RootNamespace::add(const Namespace& ns) {
 		// no duplicate children
-		if (m_pChildren->cend() != m_pChildren->find(ns.id()))
+		const auto& rootChildren = children();
+		if (rootChildren.cend() != rootChildren.find(ns.id()))
 			CATAPULT_THROW_INVALID_ARGUMENT_1("child namespace already exists (id)", ns.id());
 
 		// parent must be known and must be on same level
 		if (id() != ns.parentId()) {
-			auto iter = m_pChildren->find(ns.parentId());
-			if (m_pChildren->cend() == iter)
+			auto iter = rootChildren.find(ns.parentId());
+			if (rootChildren.cend() == iter)
 				CATAPULT_THROW_INVALID_ARGUMENT_2("child namespace has no parent, (child id, parent id)", ns.id(), ns.parentId());
 
 			if (iter->second.Path.size() != ns.path().size() - 1)
@@ -102,18 +105,19 @@ namespace catapult { namespace state {
 		if (id() != ns.rootId())
 			CATAPULT_THROW_INVALID_ARGUMENT_2("child namespace has incorrect root, (child id, root id)", ns.id(), ns.rootId());
 
-		m_pChildren->emplace(ns.id(), ns.path());
+		mutableChildren().emplace(ns.id(), ns.path());
 	}
 
 	void RootNamespace::remove(NamespaceId id) {
-		auto iter = m_pChildren->find(id);
-		if (m_pChildren->cend() == iter)
+		const auto& rootChildren = children();
+		auto iter = rootChildren.find(id);
+		if (rootChildren.cend() == iter)
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot remove child namespace (id)", id);
 
 		// only allow removal if it has no descendents
 		// note that all children have a level >= 2
 		auto level = iter->second.Path.size();
-		auto hasDescendents = std::any_of(m_pChildren->cbegin(), m_pChildren->cend(), [level, id](const auto& pair) {
+		auto hasDescendents = std::any_of(rootChildren.cbegin(), rootChildren.cend(), [level, id](const auto& pair) {
 			const auto& path = pair.second.Path;
 			return level < path.size() && id == path[level - 1];
 		});
@@ -121,7 +125,7 @@ namespace catapult { namespace state {
 		if (hasDescendents)
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot remove child namespace because it has decendents (id)", id);
 
-		m_pChildren->erase(id);
+		mutableChildren().erase(id);
 	}
 
 	void RootNamespace::setAlias(NamespaceId id, const NamespaceAlias& alias) {
@@ -132,8 +136,9 @@ namespace catapult { namespace state {
 		}
 
 		// child must exist
-		auto iter = m_pChildren->find(id);
-		if (m_pChildren->cend() == iter)
+		auto& rootChildren = mutableChildren();
+		auto iter = rootChildren.find(id);
+		if (rootChildren.cend() == iter)
 			CATAPULT_THROW_INVALID_ARGUMENT_2("namespace (id) being linked is not under (root)", id, m_id);
 
 		iter->second.Alias = alias;
@@ -152,12 +157,30 @@ namespace catapult { namespace state {
 	}
 
 	RootNamespace RootNamespace::renew(const NamespaceLifetime& newLifetime) const {
-		return RootNamespace(m_id, m_ownerAddress, newLifetime, m_pChildren);
+		auto renewedRoot = *this;
+		renewedRoot.m_alias = NamespaceAlias();
+		renewedRoot.m_lifetime = newLifetime;
+		return renewedRoot;
+	}
+
+	RootNamespace RootNamespace::detach() const {
+		auto detachedRoot = RootNamespace(m_id, m_ownerAddress, m_lifetime, m_pSharedChildren->pChildren);
+		detachedRoot.m_alias = m_alias;
+		return detachedRoot;
+	}
+
+	RootNamespace::Children& RootNamespace::mutableChildren() {
+		// children are shared with at least one detached root namespace, so they need to be copied before being modified
+		auto& pChildren = m_pSharedChildren->pChildren;
+		if (1 != pChildren.use_count())
+			pChildren = std::make_shared<Children>(*pChildren);
+
+		return *pChildren;
 	}
 
 	RootNamespace::OrderedChildPaths RootNamespace::sortedChildPaths() const {
 		RootNamespace::OrderedChildPaths orderedPaths;
-		for (const auto& child : *m_pChildren)
+		for (const auto& child : children())
 			orderedPaths.insert(child.second.Path);
 
 		return orderedPaths;
@@ -122,15 +122,30 @@ namespace catapult { namespace state {
 		/// \note The method shares the children of this root namespace with the new root namespace.
 		RootNamespace renew(const NamespaceLifetime& newLifetime) const;
 
+		/// Creates a copy of this root namespace that does not observe subsequent modifications of the children of this root namespace.
+		/// \note The children are shared with this root namespace until either one modifies them.
+		RootNamespace detach() const;
+
 		/// Creates an ordered set of child namespace paths.
 		/// \note Child paths are ordered lexicographically.
 		OrderedChildPaths sortedChildPaths() const;
 
+	private:
+		// children shared by all root namespaces with the same owner that extend each other;
+		// the underlying container can additionally be shared across detached copies and is copied on first write
+		struct SharedChildren {
+		public:
+			std::shared_ptr<Children> pChildren;
+		};
+
+	private:
+		Children& mutableChildren();
+
 	private:
 		NamespaceId m_id;
 		NamespaceAlias m_alias; // root namespace alias
 		Address m_ownerAddress;
 		NamespaceLifetime m_lifetime;
-		std::shared_ptr<Children> m_pChildren;
+		std::shared_ptr<SharedChildren> m_pSharedChildren;
 	};
 }}
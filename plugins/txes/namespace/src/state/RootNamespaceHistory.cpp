@@ -43,14 +43,15 @@ namespace catapult { namespace state {
 		if (history.empty())
 			return;
 
+		// children are not copied eagerly; instead, each copied root namespace shares them with its original until either is modified
 		const RootNamespace* pPreviousRoot = nullptr;
-		std::shared_ptr<RootNamespace::Children> pChildren;
 		for (const auto& root : history) {
-			if (!pPreviousRoot || !root.canExtend(*pPreviousRoot))
-				pChildren = std::make_shared<RootNamespace::Children>(root.children());
-
-			m_rootHistory.emplace_back(root.id(), root.ownerAddress(), root.lifetime(), pChildren);
-			m_rootHistory.back().setAlias(root.id(), root.alias(root.id()));
+			if (!pPreviousRoot || !root.canExtend(*pPreviousRoot)) {
+				m_rootHistory.push_back(root.detach());
+			} else {
+				m_rootHistory.push_back(m_rootHistory.back().renew(root.lifetime()));
+				m_rootHistory.back().setAlias(root.id(), root.alias(root.id()));
+			}
 
 			pPreviousRoot = &root;
 		}
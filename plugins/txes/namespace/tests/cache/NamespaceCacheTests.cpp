@@ -805,6 +805,161 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region findAlias
+
+	namespace {
+		template<typename TAction>
+		void RunFindAliasTest(TAction action) {
+			// Arrange: insert a root with child and set aliases for both
+			NamespaceCacheMixinTraits::CacheType cache;
+			auto owner = test::CreateRandomOwner();
+			auto aliasedAddress = test::GenerateRandomByteArray<Address>();
+
+			auto delta = cache.createDelta();
+			delta->insert(state::RootNamespace(NamespaceId(123), owner, test::CreateLifetime(234, 321)));
+			delta->insert(state::Namespace(test::CreatePath({ 123, 127 })));
+			delta->setAlias(NamespaceId(123), state::NamespaceAlias(MosaicId(444)));
+			delta->setAlias(NamespaceId(127), state::NamespaceAlias(aliasedAddress));
+
+			// Act + Assert:
+			action(cache, delta, aliasedAddress);
+		}
+
+		void AssertAliasLookupCounters(const NamespaceCacheMixinTraits::CacheType& cache, uint64_t numHits, uint64_t numMisses) {
+			const auto& counters = cache.createView()->aliasLookupCounters();
+			EXPECT_EQ(numHits, counters.NumHits);
+			EXPECT_EQ(numMisses, counters.NumMisses);
+		}
+	}
+
+	TEST(TEST_CLASS, FindAliasReturnsAliasesOfKnownNamespaces) {
+		// Arrange:
+		RunFindAliasTest([](const auto&, const auto& delta, const auto& aliasedAddress) {
+			// Act:
+			auto rootAlias = delta->findAlias(NamespaceId(123));
+			auto childAlias = delta->findAlias(NamespaceId(127));
+
+			// Assert:
+			EXPECT_EQ(state::AliasType::Mosaic, rootAlias.type());
+			EXPECT_EQ(MosaicId(444), rootAlias.mosaicId());
+
+			EXPECT_EQ(state::AliasType::Address, childAlias.type());
+			EXPECT_EQ(aliasedAddress, childAlias.address());
+		});
+	}
+
+	TEST(TEST_CLASS, FindAliasReturnsEmptyAliasForUnknownNamespace) {
+		// Arrange:
+		RunFindAliasTest([](const auto&, const auto& delta, const auto&) {
+			// Act:
+			auto alias = delta->findAlias(NamespaceId(129));
+
+			// Assert:
+			EXPECT_EQ(state::AliasType::None, alias.type());
+		});
+	}
+
+	TEST(TEST_CLASS, FindAliasCanBeCalledOnView) {
+		// Arrange:
+		RunFindAliasTest([](auto& cache, const auto&, const auto& aliasedAddress) {
+			cache.commit();
+
+			// Act:
+			auto view = cache.createView();
+			auto rootAlias = view->findAlias(NamespaceId(123));
+			auto childAlias = view->findAlias(NamespaceId(127));
+			auto unknownAlias = view->findAlias(NamespaceId(129));
+
+			// Assert:
+			EXPECT_EQ(MosaicId(444), rootAlias.mosaicId());
+			EXPECT_EQ(aliasedAddress, childAlias.address());
+			EXPECT_EQ(state::AliasType::None, unknownAlias.type());
+
+			// - view lookups are not memoized
+			AssertAliasLookupCounters(cache, 0, 0);
+		});
+	}
+
+	TEST(TEST_CLASS, FindAliasMemoizesDeltaLookups) {
+		// Arrange:
+		RunFindAliasTest([](const auto& cache, const auto& delta, const auto& aliasedAddress) {
+			// Act:
+			for (auto i = 0u; i < 3; ++i) {
+				delta->findAlias(NamespaceId(123));
+				delta->findAlias(NamespaceId(127));
+				delta->findAlias(NamespaceId(129));
+			}
+
+			// Assert:
+			AssertAliasLookupCounters(cache, 6, 3);
+			EXPECT_EQ(MosaicId(444), delta->findAlias(NamespaceId(123)).mosaicId());
+			EXPECT_EQ(aliasedAddress, delta->findAlias(NamespaceId(127)).address());
+		});
+	}
+
+	TEST(TEST_CLASS, FindAliasMemoIsClearedBySetAlias) {
+		// Arrange:
+		RunFindAliasTest([](const auto& cache, auto& delta, const auto&) {
+			delta->findAlias(NamespaceId(127));
+
+			// Act:
+			delta->setAlias(NamespaceId(127), state::NamespaceAlias());
+			auto alias = delta->findAlias(NamespaceId(127));
+
+			// Assert:
+			EXPECT_EQ(state::AliasType::None, alias.type());
+			AssertAliasLookupCounters(cache, 0, 2);
+		});
+	}
+
+	TEST(TEST_CLASS, FindAliasMemoIsClearedByInsert) {
+		// Arrange:
+		RunFindAliasTest([](const auto& cache, auto& delta, const auto&) {
+			delta->findAlias(NamespaceId(129));
+
+			// Act:
+			delta->insert(state::Namespace(test::CreatePath({ 123, 129 })));
+			delta->setAlias(NamespaceId(129), state::NamespaceAlias(MosaicId(555)));
+			auto alias = delta->findAlias(NamespaceId(129));
+
+			// Assert:
+			EXPECT_EQ(MosaicId(555), alias.mosaicId());
+			AssertAliasLookupCounters(cache, 0, 2);
+		});
+	}
+
+	TEST(TEST_CLASS, FindAliasMemoIsClearedByRemove) {
+		// Arrange:
+		RunFindAliasTest([](const auto& cache, auto& delta, const auto&) {
+			delta->findAlias(NamespaceId(127));
+
+			// Act:
+			delta->remove(NamespaceId(127));
+			auto alias = delta->findAlias(NamespaceId(127));
+
+			// Assert:
+			EXPECT_EQ(state::AliasType::None, alias.type());
+			AssertAliasLookupCounters(cache, 0, 2);
+		});
+	}
+
+	TEST(TEST_CLASS, FindAliasMemoIsClearedByPrune) {
+		// Arrange:
+		RunFindAliasTest([](const auto& cache, auto& delta, const auto&) {
+			delta->findAlias(NamespaceId(123));
+
+			// Act: prune at root expiry height
+			delta->prune(Height(321));
+			auto alias = delta->findAlias(NamespaceId(123));
+
+			// Assert:
+			EXPECT_EQ(state::AliasType::None, alias.type());
+			AssertAliasLookupCounters(cache, 0, 2);
+		});
+	}
+
+	// endregion
+
 	// region remove
 
 	TEST(TEST_CLASS, CannotRemoveUnknownNamespace) {
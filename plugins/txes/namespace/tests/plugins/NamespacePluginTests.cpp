@@ -90,7 +90,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<std::string> GetDiagnosticCounterNames() {
-				return { "NS C", "NS C AS", "NS C DS" };
+				return { "NS C", "NS C AS", "NS C DS", "NS C AL HIT", "NS C AL MISS" };
 			}
 
 			static std::vector<std::string> GetStatelessValidatorNames() {
@@ -307,6 +307,96 @@ namespace catapult { namespace state {
 		EXPECT_EQ(expectedChildIds, GetChildIdSets(history));
 	}
 
+	namespace {
+		RootNamespaceHistory CreateHistoryWithSharedChildren(const Address& owner) {
+			RootNamespaceHistory history(NamespaceId(123));
+			history.push_back(owner, test::CreateLifetime(234, 321));
+			AddDefaultChildren(history.back());
+			history.push_back(owner, test::CreateLifetime(320, 469));
+			return history;
+		}
+
+		void AssertRootsShareChildren(const RootNamespaceHistory& history) {
+			const auto& firstRoot = *history.begin();
+			const auto& lastRoot = history.back();
+			EXPECT_EQ(&firstRoot.children(), &lastRoot.children());
+		}
+	}
+
+	TEST(TEST_CLASS, CopyConstructorSharesChildrenWithOriginalUntilModified) {
+		// Arrange:
+		auto owner = test::CreateRandomOwner();
+		auto original = CreateHistoryWithSharedChildren(owner);
+
+		// Act:
+		RootNamespaceHistory history(original);
+
+		// Assert: children are not copied
+		EXPECT_EQ(&original.back().children(), &history.back().children());
+		AssertRootsShareChildren(history);
+		EXPECT_EQ(8u, history.numAllHistoricalChildren());
+	}
+
+	TEST(TEST_CLASS, ModifyingChildrenOfCopyDoesNotModifyOriginal) {
+		// Arrange:
+		auto owner = test::CreateRandomOwner();
+		auto original = CreateHistoryWithSharedChildren(owner);
+		RootNamespaceHistory history(original);
+
+		// Act:
+		history.back().add(Namespace(test::CreatePath({ 123, 126 })));
+		history.back().remove(NamespaceId(357));
+		history.back().setAlias(NamespaceId(124), NamespaceAlias(MosaicId(246)));
+
+		// Assert: copy has modified children that are still shared by all its roots
+		EXPECT_NE(&original.back().children(), &history.back().children());
+		AssertRootsShareChildren(history);
+		EXPECT_EQ(8u, history.numAllHistoricalChildren());
+		EXPECT_EQ(IdSet({ NamespaceId(124), NamespaceId(125), NamespaceId(126), NamespaceId(128) }), GetChildIdSets(history)[0]);
+		EXPECT_EQ(MosaicId(246), history.back().alias(NamespaceId(124)).mosaicId());
+
+		// - original is unchanged
+		AssertRootsShareChildren(original);
+		EXPECT_EQ(8u, original.numAllHistoricalChildren());
+		test::AssertChildren(CreateDefaultChildren(), original.back().children());
+		EXPECT_EQ(AliasType::None, original.back().alias(NamespaceId(124)).type());
+	}
+
+	TEST(TEST_CLASS, ModifyingChildrenOfOriginalDoesNotModifyCopy) {
+		// Arrange:
+		auto owner = test::CreateRandomOwner();
+		auto original = CreateHistoryWithSharedChildren(owner);
+		RootNamespaceHistory history(original);
+
+		// Act:
+		original.back().add(Namespace(test::CreatePath({ 123, 126 })));
+
+		// Assert:
+		EXPECT_NE(&original.back().children(), &history.back().children());
+		AssertRootsShareChildren(original);
+		EXPECT_EQ(10u, original.numAllHistoricalChildren());
+
+		AssertRootsShareChildren(history);
+		EXPECT_EQ(8u, history.numAllHistoricalChildren());
+		test::AssertChildren(CreateDefaultChildren(), history.back().children());
+	}
+
+	TEST(TEST_CLASS, RenewingRootOfCopyDoesNotCopyChildren) {
+		// Arrange:
+		auto owner = test::CreateRandomOwner();
+		auto original = CreateHistoryWithSharedChildren(owner);
+		RootNamespaceHistory history(original);
+
+		// Act:
+		history.push_back(owner, test::CreateLifetime(400, 876));
+
+		// Assert:
+		EXPECT_EQ(&original.back().children(), &history.back().children());
+		EXPECT_EQ(3u, history.historyDepth());
+		EXPECT_EQ(12u, history.numAllHistoricalChildren());
+		EXPECT_EQ(2u, original.historyDepth());
+	}
+
 	// endregion
 
 	// region push_back
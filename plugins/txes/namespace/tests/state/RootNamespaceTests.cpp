@@ -382,6 +382,84 @@ namespace catapult { namespace state {
 		EXPECT_EQ(&root.children(), &renewedRoot.children());
 	}
 
+	TEST(TEST_CLASS, RenewedRootObservesChildModifications) {
+		// Arrange:
+		auto owner = test::CreateRandomOwner();
+		auto root = CreateDefaultRootWithChildren(owner);
+		auto renewedRoot = root.renew(test::CreateLifetime(468, 579));
+
+		// Act:
+		renewedRoot.add(Namespace(test::CreatePath({ 123, 126 })));
+
+		// Assert:
+		EXPECT_EQ(5u, root.size());
+		EXPECT_EQ(&root.children(), &renewedRoot.children());
+	}
+
+	// endregion
+
+	// region detach
+
+	TEST(TEST_CLASS, CanDetachRoot) {
+		// Arrange:
+		auto owner = test::CreateRandomOwner();
+		auto root = CreateDefaultRootWithChildren(owner);
+		root.setAlias(NamespaceId(123), NamespaceAlias(MosaicId(444)));
+
+		// Act:
+		auto detachedRoot = root.detach();
+
+		// Assert: children are shared until modified
+		EXPECT_EQ(root, detachedRoot);
+		EXPECT_EQ(test::CreateLifetime(234, 321), detachedRoot.lifetime());
+		EXPECT_EQ(MosaicId(444), detachedRoot.alias(NamespaceId(123)).mosaicId());
+		EXPECT_EQ(&root.children(), &detachedRoot.children());
+	}
+
+	namespace {
+		template<typename TAction>
+		void AssertDetachedRootDoesNotObserveChildModifications(TAction action) {
+			// Arrange:
+			auto owner = test::CreateRandomOwner();
+			auto root = CreateDefaultRootWithChildren(owner);
+			auto detachedRoot = root.detach();
+			auto renewedRoot = root.renew(test::CreateLifetime(468, 579));
+
+			// Act:
+			action(root);
+
+			// Assert: the modified root got its own children, which are still shared with the renewed root
+			EXPECT_NE(&root.children(), &detachedRoot.children());
+			EXPECT_EQ(&root.children(), &renewedRoot.children());
+
+			// - detached root is unchanged
+			EXPECT_EQ(4u, detachedRoot.size());
+			for (auto id : { 357u, 124u, 125u, 128u })
+				EXPECT_EQ(AliasType::None, detachedRoot.alias(NamespaceId(id)).type()) << id;
+		}
+	}
+
+	TEST(TEST_CLASS, DetachedRootDoesNotObserveChildAdd) {
+		AssertDetachedRootDoesNotObserveChildModifications([](auto& root) {
+			root.add(Namespace(test::CreatePath({ 123, 126 })));
+			EXPECT_EQ(5u, root.size());
+		});
+	}
+
+	TEST(TEST_CLASS, DetachedRootDoesNotObserveChildRemove) {
+		AssertDetachedRootDoesNotObserveChildModifications([](auto& root) {
+			root.remove(NamespaceId(357));
+			EXPECT_EQ(3u, root.size());
+		});
+	}
+
+	TEST(TEST_CLASS, DetachedRootDoesNotObserveChildSetAlias) {
+		AssertDetachedRootDoesNotObserveChildModifications([](auto& root) {
+			root.setAlias(NamespaceId(124), NamespaceAlias(MosaicId(246)));
+			EXPECT_EQ(MosaicId(246), root.alias(NamespaceId(124)).mosaicId());
+		});
+	}
+
 	// endregion
 
 	// region sortedChildPaths
@@ -24,6 +24,7 @@
 #include "CatapultCacheView.h"
 #include "ChunkedDataLoader.h"
 #include "catapult/exceptions.h"
+#include <future>
 
 namespace catapult { namespace cache {
 
@@ -59,12 +60,23 @@ namespace catapult { namespace cache {
 		}
 
 		void loadAll(io::InputStream& input, size_t batchSize) override {
-			auto delta = m_cache.createDelta();
+			using ChunkType = std::vector<typename ChunkedDataLoader<TStorageTraits>::ValueType>;
 
 			ChunkedDataLoader<TStorageTraits> loader(input);
-			while (loader.hasNext()) {
-				loader.next(batchSize, *delta);
+			auto delta = m_cache.createDelta();
+
+			// parse each chunk on a separate thread while the previous chunk is being inserted
+			auto values = loader.nextChunk(batchSize);
+			while (!values.empty()) {
+				std::future<ChunkType> nextValuesFuture;
+				if (loader.hasNext())
+					nextValuesFuture = std::async(std::launch::async, [&loader, batchSize]() { return loader.nextChunk(batchSize); });
+
+				for (const auto& value : values)
+					TStorageTraits::LoadInto(value, *delta);
+
 				m_cache.commit();
+				values = nextValuesFuture.valid() ? nextValuesFuture.get() : ChunkType();
 			}
 		}
 
@@ -23,12 +23,18 @@
 #include "catapult/io/PodIoUtils.h"
 #include "catapult/io/Stream.h"
 #include "catapult/functions.h"
+#include <utility>
+#include <vector>
 
 namespace catapult { namespace cache {
 
 	/// Loads data from an input stream in chunks.
 	template<typename TStorageTraits>
 	class ChunkedDataLoader {
+	public:
+		/// Type of loaded values.
+		using ValueType = decltype(TStorageTraits::Load(std::declval<io::InputStream&>()));
+
 	public:
 		/// Creates a chunked loader around \a input.
 		explicit ChunkedDataLoader(io::InputStream& input) : m_input(input) {
@@ -49,6 +55,20 @@ namespace catapult { namespace cache {
 				TStorageTraits::LoadInto(TStorageTraits::Load(m_input), destination);
 		}
 
+		/// Loads the next data chunk of at most \a numRequestedEntries without inserting it into a destination.
+		/// \note This allows the next chunk to be parsed while the previous chunk is being inserted.
+		std::vector<ValueType> nextChunk(uint64_t numRequestedEntries) {
+			numRequestedEntries = std::min(numRequestedEntries, m_numRemainingEntries);
+			m_numRemainingEntries -= numRequestedEntries;
+
+			std::vector<ValueType> values;
+			values.reserve(numRequestedEntries);
+			while (numRequestedEntries--)
+				values.push_back(TStorageTraits::Load(m_input));
+
+			return values;
+		}
+
 	private:
 		io::InputStream& m_input;
 		uint64_t m_numRemainingEntries;
@@ -27,14 +27,19 @@
 namespace catapult { namespace cache {
 
 	/// Adds \a identifier with grouping \a key to \a groupedSet.
+	/// \note An existing group is looked up once; a new group is inserted with \a identifier already added.
 	template<typename TGroupedSet, typename TGroupingKey, typename TIdentifier>
 	void AddIdentifierWithGroup(TGroupedSet& groupedSet, const TGroupingKey& key, const TIdentifier& identifier) {
-		if (!groupedSet.contains(key))
-			groupedSet.insert(typename TGroupedSet::ElementType(key));
-
 		auto groupIter = groupedSet.find(key);
 		auto* pGroup = groupIter.get();
-		pGroup->add(identifier);
+		if (pGroup) {
+			pGroup->add(identifier);
+			return;
+		}
+
+		auto group = typename TGroupedSet::ElementType(key);
+		group.add(identifier);
+		groupedSet.insert(group);
 	}
 
 	/// Calls \a action for each value in \a set with grouping \a key according to \a groupedSet.
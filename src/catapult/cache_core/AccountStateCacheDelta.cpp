@@ -79,25 +79,28 @@ namespace catapult { namespace cache {
 		return m_options.HarvestingMosaicId;
 	}
 
-	namespace {
-		template<typename TIterator>
-		TIterator PrepareMutableIterator(TIterator&& iter, const AccountStateCacheTypes::Options& options) {
+	template<typename TIterator>
+	TIterator BasicAccountStateCacheDelta::prepareMutableIterator(TIterator&& iter) {
+		if (iter.tryGet()) {
 			// in order to guarantee deterministic sorting of mosaics, CurrencyMosaicId always needs to be set as the optimized mosaic id
 			// before the iterator is returned because that information is lost during serialization when the AccountState doesn't
 			// contain any CurrencyMosaicId balance
-			if (iter.tryGet())
-				iter.get().Balances.optimize(options.CurrencyMosaicId);
+			auto& accountState = iter.get();
+			accountState.Balances.optimize(m_options.CurrencyMosaicId);
 
-			return std::move(iter);
+			// any mutable access can change high value account eligibility
+			m_modifiedAddresses.insert(accountState.Address);
 		}
+
+		return std::move(iter);
 	}
 
 	AccountStateCacheDeltaMixins::MutableAccessorAddress::iterator BasicAccountStateCacheDelta::find(const Address& address) {
-		return PrepareMutableIterator(AccountStateCacheDeltaMixins::MutableAccessorAddress(*m_pStateByAddress).find(address), m_options);
+		return prepareMutableIterator(AccountStateCacheDeltaMixins::MutableAccessorAddress(*m_pStateByAddress).find(address));
 	}
 
 	AccountStateCacheDeltaMixins::MutableAccessorKey::iterator BasicAccountStateCacheDelta::find(const Key& key) {
-		return PrepareMutableIterator(AccountStateCacheDeltaMixins::MutableAccessorKey(*m_pKeyLookupAdapter).find(key), m_options);
+		return prepareMutableIterator(AccountStateCacheDeltaMixins::MutableAccessorKey(*m_pKeyLookupAdapter).find(key));
 	}
 
 	void BasicAccountStateCacheDelta::addAccount(const Address& address, Height height) {
@@ -132,6 +135,7 @@ namespace catapult { namespace cache {
 
 		m_pStateByAddress->insert(accountState);
 		m_pStateByAddress->find(accountState.Address).get()->Balances.optimize(m_options.CurrencyMosaicId);
+		m_modifiedAddresses.insert(accountState.Address);
 	}
 
 	void BasicAccountStateCacheDelta::queueRemove(const Address& address, Height height) {
@@ -167,7 +171,8 @@ namespace catapult { namespace cache {
 
 	void BasicAccountStateCacheDelta::updateHighValueAccounts(Height height) {
 		m_highValueAccountsUpdater.setHeight(height);
-		m_highValueAccountsUpdater.update(m_pStateByAddress->deltas());
+		m_highValueAccountsUpdater.update(m_pStateByAddress->deltas(), m_modifiedAddresses);
+		m_modifiedAddresses.clear();
 	}
 
 	void BasicAccountStateCacheDelta::processHighValueRemovedAccounts(model::ImportanceHeight importanceHeight) {
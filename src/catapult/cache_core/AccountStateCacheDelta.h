@@ -154,6 +154,7 @@ namespace catapult { namespace cache {
 		const HighValueAccountsUpdater& highValueAccounts() const;
 
 		/// Updates high value accounts at \a height.
+		/// \note Only accounts that have been accessed mutably since the last update are processed.
 		void updateHighValueAccounts(Height height);
 
 		/// Processes removed high value accounts at \a height.
@@ -166,6 +167,9 @@ namespace catapult { namespace cache {
 		void prune(Height height);
 
 	private:
+		template<typename TIterator>
+		TIterator prepareMutableIterator(TIterator&& iter);
+
 		Address getAddress(const Key& publicKey);
 
 		void remove(const Address& address, Height height);
@@ -195,6 +199,7 @@ namespace catapult { namespace cache {
 		const AccountStateCacheTypes::Options& m_options;
 		std::unique_ptr<AccountStateCacheDeltaMixins::KeyLookupAdapter> m_pKeyLookupAdapter;
 		HighValueAccountsUpdater m_highValueAccountsUpdater;
+		model::AddressSet m_modifiedAddresses;
 
 		QueuedRemovalSet<Address> m_queuedRemoveByAddress;
 		QueuedRemovalSet<Key> m_queuedRemoveByPublicKey;
@@ -21,6 +21,7 @@
 
 #include "HighValueAccounts.h"
 #include "catapult/utils/ContainerHelpers.h"
+#include <algorithm>
 
 namespace catapult { namespace cache {
 
@@ -69,46 +70,45 @@ namespace catapult { namespace cache {
 			bool HasHistoricalInformation;
 		};
 
-		using HighValueAccountDescriptorCalculator = std::function<HighValueAccountDescriptor (const state::AccountState&)>;
+		bool Contains(const model::AddressSet& addresses, const Address& address) {
+			return addresses.cend() != addresses.find(address);
+		}
 
 		class HighValueAddressesUpdater {
-		private:
-			using MemorySetType = AccountStateCacheTypes::PrimaryTypes::BaseSetDeltaType::SetType::MemorySetType;
-
 		public:
 			HighValueAddressesUpdater(
 					const model::AddressSet& originalAddresses,
-					model::AddressSet& currentAddresses,
-					model::AddressSet& removedAddresses)
+					detail::CopyOnWriteContainer<model::AddressSet>& currentAddresses,
+					detail::CopyOnWriteContainer<model::AddressSet>& removedAddresses)
 					: m_original(originalAddresses)
 					, m_current(currentAddresses)
 					, m_removed(removedAddresses)
 			{}
 
 		public:
-			void update(const MemorySetType& source, const HighValueAccountDescriptorCalculator& highValueAccountDescriptorCalculator) {
-				for (const auto& pair : source)
-					updateOne(pair.second.Address, highValueAccountDescriptorCalculator(pair.second));
-			}
-
-		private:
-			void updateOne(const Address& address, const HighValueAccountDescriptor& descriptor) {
+			void update(const Address& address, const HighValueAccountDescriptor& descriptor) {
+				// only modify containers when membership changes in order to avoid unnecessary copies
 				if (descriptor.IsHighValue) {
-					m_current.insert(address);
-					m_removed.erase(address);
+					if (!Contains(m_current.get(), address))
+						m_current.modify().insert(address);
+
+					if (Contains(m_removed.get(), address))
+						m_removed.modify().erase(address);
 				} else {
-					m_current.erase(address);
+					if (Contains(m_current.get(), address))
+						m_current.modify().erase(address);
 
 					// need to check HasHistoricalInformation in order for multiblock syncs to work
-					if (m_original.cend() != m_original.find(address) || descriptor.HasHistoricalInformation)
-						m_removed.insert(address);
+					auto isRemoved = Contains(m_original, address) || descriptor.HasHistoricalInformation;
+					if (isRemoved && !Contains(m_removed.get(), address))
+						m_removed.modify().insert(address);
 				}
 			}
 
 		private:
 			const model::AddressSet& m_original;
-			model::AddressSet& m_current;
-			model::AddressSet& m_removed;
+			detail::CopyOnWriteContainer<model::AddressSet>& m_current;
+			detail::CopyOnWriteContainer<model::AddressSet>& m_removed;
 		};
 	}
 
@@ -117,54 +117,94 @@ namespace catapult { namespace cache {
 	// region HighValueBalancesUpdater
 
 	namespace {
-		using EffectiveBalanceCalculator = std::function<std::pair<Amount, bool> (const state::AccountState&)>;
-
 		class HighValueBalancesUpdater {
-		private:
-			using MemorySetType = AccountStateCacheTypes::PrimaryTypes::BaseSetDeltaType::SetType::MemorySetType;
-
 		public:
-			HighValueBalancesUpdater(AddressAccountHistoryMap& accountHistories, Height height)
+			HighValueBalancesUpdater(detail::CopyOnWriteContainer<AddressAccountHistoryMap>& accountHistories, Height height)
 					: m_accountHistories(accountHistories)
 					, m_height(height)
 			{}
 
 		public:
-			void update(const MemorySetType& source, const EffectiveBalanceCalculator& effectiveBalanceCalculator) {
-				for (const auto& pair : source)
-					updateOne(pair.second, effectiveBalanceCalculator(pair.second));
+			void update(const state::AccountState& accountState, const std::pair<Amount, bool>& effectiveBalancePair) {
+				const auto& accountHistories = m_accountHistories.get();
+				auto accountHistoriesIter = accountHistories.find(accountState.Address);
+				if (accountHistories.cend() == accountHistoriesIter) {
+					// if this account has a newly high balance, start tracking it
+					if (!effectiveBalancePair.second)
+						return;
+				} else if (IsUnchanged(accountHistoriesIter->second, accountState, effectiveBalancePair.first)) {
+					return;
+				}
+
+				// if this account is tracked, add tracked values
+				auto& accountHistory = m_accountHistories.modify()[accountState.Address];
+				accountHistory.add(m_height, effectiveBalancePair.first);
+				accountHistory.add(m_height, accountState.SupplementalPublicKeys.vrf().get());
+				accountHistory.add(m_height, accountState.SupplementalPublicKeys.voting().getAll());
+				m_updatedAddresses.push_back(accountState.Address);
 			}
 
 			void pruneGreater() {
-				for (auto& pair : m_accountHistories)
+				// only modify histories when there is something to prune in order to avoid unnecessary copies
+				const auto& accountHistories = m_accountHistories.get();
+				auto hasGreater = std::any_of(accountHistories.cbegin(), accountHistories.cend(), [height = m_height](const auto& pair) {
+					return HasValueAtGreaterHeight(pair.second, height);
+				});
+
+				if (!hasGreater)
+					return;
+
+				for (auto& pair : m_accountHistories.modify())
 					pair.second.pruneGreater(m_height);
 			}
 
 			void prune(Amount minBalance) {
-				utils::map_erase_if(m_accountHistories, [minBalance](const auto& pair) {
+				auto isPrunable = [minBalance](const auto& pair) {
 					return !pair.second.anyAtLeast(minBalance);
-				});
-			}
+				};
 
-		private:
-			void updateOne(const state::AccountState& accountState, const std::pair<Amount, bool>& effectiveBalancePair) {
-				auto accountHistoriesIter = m_accountHistories.find(accountState.Address);
+				const auto& accountHistories = m_accountHistories.get();
+				if (std::none_of(accountHistories.cbegin(), accountHistories.cend(), isPrunable))
+					return;
 
-				// if this account has a newly high balance, start tracking it
-				if (m_accountHistories.cend() == accountHistoriesIter && effectiveBalancePair.second)
-					accountHistoriesIter = m_accountHistories.emplace(accountState.Address, state::AccountHistory()).first;
+				utils::map_erase_if(m_accountHistories.modify(), isPrunable);
+			}
 
-				// if this account is tracked, add tracked values
-				if (m_accountHistories.cend() != accountHistoriesIter) {
-					accountHistoriesIter->second.add(m_height, effectiveBalancePair.first);
-					accountHistoriesIter->second.add(m_height, accountState.SupplementalPublicKeys.vrf().get());
-					accountHistoriesIter->second.add(m_height, accountState.SupplementalPublicKeys.voting().getAll());
+			void pruneUpdated(Amount minBalance) {
+				if (m_updatedAddresses.empty())
+					return;
+
+				auto& accountHistories = m_accountHistories.modify();
+				for (const auto& address : m_updatedAddresses) {
+					auto accountHistoriesIter = accountHistories.find(address);
+					if (accountHistories.cend() != accountHistoriesIter && !accountHistoriesIter->second.anyAtLeast(minBalance))
+						accountHistories.erase(accountHistoriesIter);
 				}
 			}
 
 		private:
-			AddressAccountHistoryMap& m_accountHistories;
+			static bool HasValueAtGreaterHeight(const state::AccountHistory& accountHistory, Height height) {
+				auto hasGreater = [height](const auto& history) {
+					auto heights = history.heights();
+					return !heights.empty() && heights.back() > height;
+				};
+
+				return hasGreater(accountHistory.balance())
+						|| hasGreater(accountHistory.vrfPublicKey())
+						|| hasGreater(accountHistory.votingPublicKeys());
+			}
+
+			static bool IsUnchanged(const state::AccountHistory& accountHistory, const state::AccountState& accountState, Amount balance) {
+				// adding values equal to the most recent values is a no-op when there are no values at greater heights
+				return balance == accountHistory.balance().get()
+						&& accountState.SupplementalPublicKeys.vrf().get() == accountHistory.vrfPublicKey().get()
+						&& accountState.SupplementalPublicKeys.voting().getAll() == accountHistory.votingPublicKeys().get();
+			}
+
+		private:
+			detail::CopyOnWriteContainer<AddressAccountHistoryMap>& m_accountHistories;
 			Height m_height;
+			std::vector<Address> m_updatedAddresses;
 		};
 	}
 
@@ -186,15 +226,15 @@ namespace catapult { namespace cache {
 	}
 
 	const model::AddressSet& HighValueAccountsUpdater::addresses() const {
-		return m_current;
+		return m_current.get();
 	}
 
 	const model::AddressSet& HighValueAccountsUpdater::removedAddresses() const {
-		return m_removed;
+		return m_removed.get();
 	}
 
 	const AddressAccountHistoryMap& HighValueAccountsUpdater::accountHistories() const {
-		return m_accountHistories;
+		return m_accountHistories.get();
 	}
 
 	void HighValueAccountsUpdater::setHeight(Height height) {
@@ -202,57 +242,30 @@ namespace catapult { namespace cache {
 	}
 
 	void HighValueAccountsUpdater::setRemovedAddresses(model::AddressSet&& removedAddresses) {
-		m_removed = std::move(removedAddresses);
-	}
-
-	void HighValueAccountsUpdater::update(const deltaset::DeltaElements<MemorySetType>& deltas) {
-		updateHarvestingAccounts(deltas);
-		updateVotingAccounts(deltas);
-	}
-
-	void HighValueAccountsUpdater::prune(Height height) {
-		utils::map_erase_if(m_accountHistories, [height, minBalance = m_options.MinVoterBalance](auto& pair) {
-			pair.second.pruneLess(height);
-			return !pair.second.anyAtLeast(minBalance);
-		});
-	}
-
-	HighValueAccounts HighValueAccountsUpdater::detachAccounts() {
-		auto accounts = HighValueAccounts(std::move(m_current), std::move(m_removed), std::move(m_accountHistories));
-
-		m_current.clear();
-		m_removed.clear();
-		m_accountHistories.clear();
-
-		return accounts;
+		m_removed.reset(std::move(removedAddresses));
 	}
 
 	namespace {
-		EffectiveBalanceCalculator::result_type EffectiveBalanceRetriever(
+		std::pair<Amount, bool> EffectiveBalanceRetriever(
 				const state::AccountState& accountState,
 				MosaicId harvestingMosaicId,
 				Amount minBalance) {
 			auto balance = accountState.Balances.get(harvestingMosaicId);
 			return std::make_pair(balance, balance >= minBalance);
 		}
-	}
 
-	void HighValueAccountsUpdater::updateHarvestingAccounts(const deltaset::DeltaElements<MemorySetType>& deltas) {
-		auto hasHighValue = [&options = m_options](const auto& accountState) {
+		HighValueAccountDescriptor CalculateHarvestingDescriptor(
+				const state::AccountState& accountState,
+				const AccountStateCacheTypes::Options& options) {
 			return HighValueAccountDescriptor{
 				EffectiveBalanceRetriever(accountState, options.HarvestingMosaicId, options.MinHarvesterBalance).second,
 				state::HasHistoricalInformation(accountState)
 			};
-		};
-
-		HighValueAddressesUpdater updater(m_original, m_current, m_removed);
-		updater.update(deltas.Added, hasHighValue);
-		updater.update(deltas.Copied, hasHighValue);
-		updater.update(deltas.Removed, [](const auto&) { return HighValueAccountDescriptor{ false, false }; });
-	}
+		}
 
-	void HighValueAccountsUpdater::updateVotingAccounts(const deltaset::DeltaElements<MemorySetType>& deltas) {
-		auto effectiveBalanceCalculator = [&options = m_options](const auto& accountState) {
+		std::pair<Amount, bool> CalculateVotingEffectiveBalance(
+				const state::AccountState& accountState,
+				const AccountStateCacheTypes::Options& options) {
 			if (0 != accountState.SupplementalPublicKeys.voting().size()) {
 				auto balancePair = EffectiveBalanceRetriever(accountState, options.HarvestingMosaicId, options.MinVoterBalance);
 				if (balancePair.second)
@@ -260,14 +273,93 @@ namespace catapult { namespace cache {
 			}
 
 			return std::make_pair(Amount(), false);
-		};
+		}
+	}
 
-		HighValueBalancesUpdater updater(m_accountHistories, m_height);
-		updater.pruneGreater();
-		updater.update(deltas.Added, effectiveBalanceCalculator);
-		updater.update(deltas.Copied, effectiveBalanceCalculator);
-		updater.update(deltas.Removed, [](const auto&) { return std::make_pair(Amount(), false); });
-		updater.prune(m_options.MinVoterBalance);
+	template<typename TForEachModified>
+	void HighValueAccountsUpdater::updateModified(TForEachModified forEachModified) {
+		// values at heights greater than the update height can only exist when the height did not increase (e.g. rollback);
+		// otherwise, only the histories of modified accounts need to be pruned
+		auto requiresFullPrune = Height() == m_lastUpdateHeight || m_height < m_lastUpdateHeight;
+
+		HighValueAddressesUpdater addressesUpdater(m_original, m_current, m_removed);
+		HighValueBalancesUpdater balancesUpdater(m_accountHistories, m_height);
+		if (requiresFullPrune)
+			balancesUpdater.pruneGreater();
+
+		forEachModified([&options = m_options, &addressesUpdater, &balancesUpdater](const auto& accountState, bool isRemoved) {
+			if (isRemoved) {
+				addressesUpdater.update(accountState.Address, HighValueAccountDescriptor{ false, false });
+				balancesUpdater.update(accountState, std::make_pair(Amount(), false));
+			} else {
+				addressesUpdater.update(accountState.Address, CalculateHarvestingDescriptor(accountState, options));
+				balancesUpdater.update(accountState, CalculateVotingEffectiveBalance(accountState, options));
+			}
+		});
+
+		if (requiresFullPrune)
+			balancesUpdater.prune(m_options.MinVoterBalance);
+		else
+			balancesUpdater.pruneUpdated(m_options.MinVoterBalance);
+
+		m_lastUpdateHeight = m_height;
+	}
+
+	void HighValueAccountsUpdater::update(const deltaset::DeltaElements<MemorySetType>& deltas) {
+		updateModified([&deltas](const auto& process) {
+			for (const auto& pair : deltas.Added)
+				process(pair.second, false);
+
+			for (const auto& pair : deltas.Copied)
+				process(pair.second, false);
+
+			for (const auto& pair : deltas.Removed)
+				process(pair.second, true);
+		});
+	}
+
+	void HighValueAccountsUpdater::update(
+			const deltaset::DeltaElements<MemorySetType>& deltas,
+			const model::AddressSet& modifiedAddresses) {
+		// after a rollback, accounts modified before the last update need to be reprocessed at the lower height
+		if (m_height < m_lastUpdateHeight) {
+			update(deltas);
+			return;
+		}
+
+		updateModified([&deltas, &modifiedAddresses](const auto& process) {
+			for (const auto& address : modifiedAddresses) {
+				auto iter = deltas.Added.find(address);
+				if (deltas.Added.cend() != iter) {
+					process(iter->second, false);
+					continue;
+				}
+
+				iter = deltas.Copied.find(address);
+				if (deltas.Copied.cend() != iter) {
+					process(iter->second, false);
+					continue;
+				}
+
+				iter = deltas.Removed.find(address);
+				if (deltas.Removed.cend() != iter)
+					process(iter->second, true);
+			}
+		});
+	}
+
+	void HighValueAccountsUpdater::prune(Height height) {
+		utils::map_erase_if(m_accountHistories.modify(), [height, minBalance = m_options.MinVoterBalance](auto& pair) {
+			pair.second.pruneLess(height);
+			return !pair.second.anyAtLeast(minBalance);
+		});
+
+		// force the next update to process all histories
+		m_lastUpdateHeight = Height();
+	}
+
+	HighValueAccounts HighValueAccountsUpdater::detachAccounts() {
+		return HighValueAccounts(m_current.detach(), m_removed.detach(), m_accountHistories.detach());
 	}
 
 	// endregion
@@ -64,7 +64,55 @@ namespace catapult { namespace cache {
 		AddressAccountHistoryMap m_accountHistories;
 	};
 
+	namespace detail {
+		/// Container that shares an original container until it is first modified.
+		template<typename TContainer>
+		class CopyOnWriteContainer {
+		public:
+			/// Creates a container around \a original.
+			explicit CopyOnWriteContainer(const TContainer& original)
+					: m_pOriginal(&original)
+					, m_isCopied(false)
+			{}
+
+		public:
+			/// Gets the current container.
+			const TContainer& get() const {
+				return m_isCopied ? m_container : *m_pOriginal;
+			}
+
+			/// Gets the current container for modification, copying the original container if necessary.
+			TContainer& modify() {
+				if (!m_isCopied) {
+					m_container = *m_pOriginal;
+					m_isCopied = true;
+				}
+
+				return m_container;
+			}
+
+			/// Replaces the current container with \a container.
+			void reset(TContainer&& container) {
+				m_container = std::move(container);
+				m_isCopied = true;
+			}
+
+			/// Detaches the current container and leaves an empty container in its place.
+			TContainer detach() {
+				auto container = m_isCopied ? std::move(m_container) : *m_pOriginal;
+				reset(TContainer());
+				return container;
+			}
+
+		private:
+			const TContainer* m_pOriginal;
+			TContainer m_container;
+			bool m_isCopied;
+		};
+	}
+
 	/// High value accounts updater.
+	/// \note Containers are shared with the original accounts until they are first modified.
 	class HighValueAccountsUpdater {
 	private:
 		using MemorySetType = AccountStateCacheTypes::PrimaryTypes::BaseSetDeltaType::SetType::MemorySetType;
@@ -97,6 +145,10 @@ namespace catapult { namespace cache {
 		/// Updates high value accounts based on changes described in \a deltas.
 		void update(const deltaset::DeltaElements<MemorySetType>& deltas);
 
+		/// Updates high value accounts based on changes described in \a deltas to accounts with \a modifiedAddresses.
+		/// \note Accounts that have not been modified since the last update are skipped unless the height decreased.
+		void update(const deltaset::DeltaElements<MemorySetType>& deltas, const model::AddressSet& modifiedAddresses);
+
 		/// Prunes all balances less than \a height.
 		void prune(Height height);
 
@@ -105,15 +157,16 @@ namespace catapult { namespace cache {
 		HighValueAccounts detachAccounts();
 
 	private:
-		void updateHarvestingAccounts(const deltaset::DeltaElements<MemorySetType>& deltas);
-		void updateVotingAccounts(const deltaset::DeltaElements<MemorySetType>& deltas);
+		template<typename TForEachModified>
+		void updateModified(TForEachModified forEachModified);
 
 	private:
 		AccountStateCacheTypes::Options m_options;
 		const model::AddressSet& m_original;
-		model::AddressSet m_current;
-		model::AddressSet m_removed;
-		AddressAccountHistoryMap m_accountHistories;
+		detail::CopyOnWriteContainer<model::AddressSet> m_current;
+		detail::CopyOnWriteContainer<model::AddressSet> m_removed;
+		detail::CopyOnWriteContainer<AddressAccountHistoryMap> m_accountHistories;
 		Height m_height;
+		Height m_lastUpdateHeight;
 	};
 }}
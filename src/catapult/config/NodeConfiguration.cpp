@@ -45,6 +45,7 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(EnableAutoSyncCleanup);
 
 		LOAD_NODE_PROPERTY(FileDatabaseBatchSize);
+		LOAD_NODE_PROPERTY(MaxStateDeltaSnapshots);
 
 		LOAD_NODE_PROPERTY(EnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
@@ -57,6 +57,10 @@ namespace catapult { namespace config {
 		/// \note This is recommended to be a factor of 10000.
 		uint32_t FileDatabaseBatchSize;
 
+		/// Maximum number of differential state snapshots to save between full state saves.
+		/// \note Differential state snapshots are only saved when cache database storage is disabled.
+		uint32_t MaxStateDeltaSnapshots;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool EnableTransactionSpamThrottling;
 
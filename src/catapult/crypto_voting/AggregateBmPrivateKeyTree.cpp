@@ -20,15 +20,169 @@
 **/
 
 #include "AggregateBmPrivateKeyTree.h"
+#include "catapult/utils/ExceptionLogging.h"
 #include "catapult/exceptions.h"
+#include <condition_variable>
+#include <deque>
+#include <thread>
 
 namespace catapult { namespace crypto {
 
+	// region TreePrefetcher
+
+	class AggregateBmPrivateKeyTree::TreePrefetcher {
+	public:
+		TreePrefetcher(const PrivateKeyTreeFactory& factory, size_t maxPrefetchedTrees)
+				: m_factory(factory)
+				, m_maxPrefetchedTrees(maxPrefetchedTrees)
+				, m_isUnavailable(false)
+				, m_isStopped(false)
+				, m_thread([this]() { run(); })
+		{}
+
+		~TreePrefetcher() {
+			{
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_isStopped = true;
+			}
+
+			m_condition.notify_all();
+			m_thread.join();
+		}
+
+	public:
+		size_t size() const {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			return m_trees.size();
+		}
+
+	public:
+		std::unique_ptr<BmPrivateKeyTree> next() {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			auto hasRetried = false;
+			for (;;) {
+				m_condition.wait(lock, [this]() { return !m_trees.empty() || m_isUnavailable || m_pException; });
+				if (!m_trees.empty() || m_pException || hasRetried)
+					break;
+
+				// tree was not available when it was prefetched, so try again now that it is needed
+				m_isUnavailable = false;
+				hasRetried = true;
+				m_condition.notify_all();
+			}
+
+			if (m_trees.empty()) {
+				if (m_pException)
+					std::rethrow_exception(m_pException);
+
+				return nullptr;
+			}
+
+			auto pTree = std::move(m_trees.front());
+			m_trees.pop_front();
+			m_condition.notify_all();
+			return pTree;
+		}
+
+		void retire(std::unique_ptr<BmPrivateKeyTree>&& pTree) {
+			{
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_retiredTrees.push_back(std::move(pTree));
+			}
+
+			m_condition.notify_all();
+		}
+
+	private:
+		bool shouldLoad() const {
+			return !m_isUnavailable && !m_pException && m_trees.size() < m_maxPrefetchedTrees;
+		}
+
+		void run() {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			for (;;) {
+				m_condition.wait(lock, [this]() { return m_isStopped || !m_retiredTrees.empty() || shouldLoad(); });
+
+				// always wipe retired trees, even when stopping
+				if (!m_retiredTrees.empty()) {
+					auto pTree = std::move(m_retiredTrees.front());
+					m_retiredTrees.pop_front();
+
+					lock.unlock();
+					wipe(*pTree);
+					lock.lock();
+					continue;
+				}
+
+				if (m_isStopped)
+					break;
+
+				lock.unlock();
+				auto loadResult = load();
+				lock.lock();
+
+				if (loadResult.second)
+					m_pException = loadResult.second;
+				else if (!loadResult.first)
+					m_isUnavailable = true;
+				else
+					m_trees.push_back(std::move(loadResult.first));
+
+				m_condition.notify_all();
+			}
+		}
+
+		std::pair<std::unique_ptr<BmPrivateKeyTree>, std::exception_ptr> load() {
+			try {
+				return std::make_pair(m_factory(), std::exception_ptr());
+			} catch (...) {
+				return std::make_pair(std::unique_ptr<BmPrivateKeyTree>(), std::current_exception());
+			}
+		}
+
+		static void wipe(BmPrivateKeyTree& tree) {
+			auto endKeyIdentifier = tree.options().EndKeyIdentifier;
+			try {
+				tree.wipe(endKeyIdentifier);
+			} catch (...) {
+				CATAPULT_LOG(error) << UNHANDLED_EXCEPTION_MESSAGE("wiping retired tree ending at " << endKeyIdentifier);
+			}
+		}
+
+	private:
+		PrivateKeyTreeFactory m_factory;
+		size_t m_maxPrefetchedTrees;
+
+		std::deque<std::unique_ptr<BmPrivateKeyTree>> m_trees;
+		std::deque<std::unique_ptr<BmPrivateKeyTree>> m_retiredTrees;
+		bool m_isUnavailable;
+		bool m_isStopped;
+		std::exception_ptr m_pException;
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::thread m_thread; // must be last member because it accesses other members
+	};
+
+	// endregion
+
+	// region AggregateBmPrivateKeyTree
+
 	AggregateBmPrivateKeyTree::AggregateBmPrivateKeyTree(const PrivateKeyTreeFactory& factory)
-			: m_factory(factory)
-			, m_pTree(m_factory())
+			: AggregateBmPrivateKeyTree(factory, 0)
 	{}
 
+	AggregateBmPrivateKeyTree::AggregateBmPrivateKeyTree(const PrivateKeyTreeFactory& factory, size_t maxPrefetchedTrees)
+			: m_factory(factory)
+			, m_pTree(m_factory()) {
+		if (0 != maxPrefetchedTrees)
+			m_pPrefetcher = std::make_unique<TreePrefetcher>(m_factory, maxPrefetchedTrees);
+	}
+
+	AggregateBmPrivateKeyTree::AggregateBmPrivateKeyTree(AggregateBmPrivateKeyTree&&) = default;
+
+	AggregateBmPrivateKeyTree::~AggregateBmPrivateKeyTree() = default;
+
 	const AggregateBmPrivateKeyTree::BmPublicKey& AggregateBmPrivateKeyTree::rootPublicKey() const {
 		return m_pTree->rootPublicKey();
 	}
@@ -40,8 +194,8 @@ namespace catapult { namespace crypto {
 	bool AggregateBmPrivateKeyTree::canSign(const BmKeyIdentifier& keyIdentifier) {
 		while (m_pTree && m_pTree->options().EndKeyIdentifier < keyIdentifier) {
 			auto oldEndKeyIdentifier = m_pTree->options().EndKeyIdentifier;
-			m_pTree->wipe(oldEndKeyIdentifier);
-			m_pTree = m_factory();
+			retireTree();
+			m_pTree = nextTree();
 			if (!m_pTree)
 				break;
 
@@ -75,4 +229,23 @@ namespace catapult { namespace crypto {
 
 		return signature;
 	}
+
+	size_t AggregateBmPrivateKeyTree::numPrefetchedTrees() const {
+		return m_pPrefetcher ? m_pPrefetcher->size() : 0;
+	}
+
+	std::unique_ptr<BmPrivateKeyTree> AggregateBmPrivateKeyTree::nextTree() {
+		return m_pPrefetcher ? m_pPrefetcher->next() : m_factory();
+	}
+
+	void AggregateBmPrivateKeyTree::retireTree() {
+		if (m_pPrefetcher) {
+			m_pPrefetcher->retire(std::move(m_pTree));
+			return;
+		}
+
+		m_pTree->wipe(m_pTree->options().EndKeyIdentifier);
+	}
+
+	// endregion
 }}
@@ -34,6 +34,16 @@ namespace catapult { namespace crypto {
 		/// Creates a tree around \a factory.
 		explicit AggregateBmPrivateKeyTree(const PrivateKeyTreeFactory& factory);
 
+		/// Creates a tree around \a factory that keeps up to \a maxPrefetchedTrees trees loaded ahead of use.
+		/// \note Trees are loaded and wiped on a background thread so that signing does not block on storage.
+		AggregateBmPrivateKeyTree(const PrivateKeyTreeFactory& factory, size_t maxPrefetchedTrees);
+
+		/// Move constructor.
+		AggregateBmPrivateKeyTree(AggregateBmPrivateKeyTree&& tree);
+
+		/// Destroys the tree.
+		~AggregateBmPrivateKeyTree();
+
 	public:
 		/// Gets the root public key.
 		const BmPublicKey& rootPublicKey() const;
@@ -47,8 +57,19 @@ namespace catapult { namespace crypto {
 		/// Creates the signature for \a dataBuffer at \a keyIdentifier.
 		BmTreeSignature sign(const BmKeyIdentifier& keyIdentifier, const RawBuffer& dataBuffer);
 
+		/// Gets the number of trees that have been loaded but not yet used.
+		size_t numPrefetchedTrees() const;
+
+	private:
+		std::unique_ptr<BmPrivateKeyTree> nextTree();
+		void retireTree();
+
+	private:
+		class TreePrefetcher;
+
 	private:
 		PrivateKeyTreeFactory m_factory;
 		std::unique_ptr<BmPrivateKeyTree> m_pTree;
+		std::unique_ptr<TreePrefetcher> m_pPrefetcher;
 	};
 }}
@@ -239,18 +239,27 @@ namespace catapult { namespace crypto {
 			, m_lastWipeKeyIdentifier({ BmKeyIdentifier::Invalid_Id })
 	{}
 
+	BmPrivateKeyTree::BmPrivateKeyTree(std::unique_ptr<io::SeekableStream>&& pStorage, const BmOptions& options)
+			: m_pStorage(std::move(pStorage))
+			, m_storage(*m_pStorage)
+			, m_options(options)
+			, m_lastKeyIdentifier({ BmKeyIdentifier::Invalid_Id })
+			, m_lastWipeKeyIdentifier({ BmKeyIdentifier::Invalid_Id })
+	{}
+
 	BmPrivateKeyTree::BmPrivateKeyTree(BmPrivateKeyTree&&) = default;
 
 	BmPrivateKeyTree BmPrivateKeyTree::FromStream(io::SeekableStream& storage) {
 		auto options = LoadOptions(storage);
 		BmPrivateKeyTree tree(storage, options);
+		tree.load();
+		return tree;
+	}
 
-		// FromStream loads whole level, used keys are zeroed
-		tree.m_lastKeyIdentifier = LoadKeyIdentifier(storage);
-		tree.m_lastWipeKeyIdentifier = LoadKeyIdentifier(storage);
-
-		tree.m_levels[Layer_Low] = std::make_unique<Level>(Level::FromStream(storage));
-
+	BmPrivateKeyTree BmPrivateKeyTree::FromStream(std::unique_ptr<io::SeekableStream>&& pStorage) {
+		auto options = LoadOptions(*pStorage);
+		BmPrivateKeyTree tree(std::move(pStorage), options);
+		tree.load();
 		return tree;
 	}
 
@@ -339,6 +348,14 @@ namespace catapult { namespace crypto {
 		return offset;
 	}
 
+	void BmPrivateKeyTree::load() {
+		// FromStream loads whole level, used keys are zeroed
+		m_lastKeyIdentifier = LoadKeyIdentifier(m_storage);
+		m_lastWipeKeyIdentifier = LoadKeyIdentifier(m_storage);
+
+		m_levels[Layer_Low] = std::make_unique<Level>(Level::FromStream(m_storage));
+	}
+
 	void BmPrivateKeyTree::createLevel(size_t depth, BmKeyPair&& keyPair, uint64_t startIdentifier, uint64_t endIdentifier) {
 		auto offset = levelOffset(depth);
 		m_levels[depth] = std::make_unique<Level>(Level::Create(std::move(keyPair), startIdentifier, endIdentifier));
@@ -391,5 +408,42 @@ namespace catapult { namespace crypto {
 		return true;
 	}
 
+	std::vector<bool> VerifyMulti(const RandomFiller& randomFiller, const BmTreeSignatureInput* pSignatureInputs, size_t count) {
+		// each bm tree signature is composed of two ed25519 signatures (bound and bottom) that are verified in a single batch
+		// note that keys and signatures are copied into ed25519 types, so reserve space upfront to keep input references valid
+		std::vector<Key> publicKeys;
+		std::vector<Signature> signatures;
+		std::vector<SignatureInput> inputs;
+		publicKeys.reserve(2 * count);
+		signatures.reserve(2 * count);
+		inputs.reserve(2 * count);
+
+		for (auto i = 0u; i < count; ++i) {
+			const auto& signatureInput = pSignatureInputs[i];
+			const auto& signature = signatureInput.Signature;
+
+			publicKeys.push_back(signature.Root.ParentPublicKey.copyTo<Key>());
+			signatures.push_back(signature.Root.Signature.copyTo<Signature>());
+			inputs.push_back({
+				publicKeys.back(),
+				{ signature.Bottom.ParentPublicKey, ToBuffer(signatureInput.KeyIdentifier.KeyId) },
+				signatures.back()
+			});
+
+			publicKeys.push_back(signature.Bottom.ParentPublicKey.copyTo<Key>());
+			signatures.push_back(signature.Bottom.Signature.copyTo<Signature>());
+			inputs.push_back({ publicKeys.back(), { signatureInput.Buffer }, signatures.back() });
+		}
+
+		std::vector<bool> results(count, true);
+		auto resultsPair = crypto::VerifyMulti(randomFiller, inputs.data(), inputs.size());
+		if (!resultsPair.second) {
+			for (auto i = 0u; i < count; ++i)
+				results[i] = resultsPair.first[2 * i] && resultsPair.first[2 * i + 1];
+		}
+
+		return results;
+	}
+
 	// endregion
 }}
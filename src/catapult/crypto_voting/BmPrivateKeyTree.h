@@ -23,6 +23,7 @@
 #include "BmOptions.h"
 #include "BmTreeSignature.h"
 #include "catapult/crypto/KeyPair.h"
+#include "catapult/crypto/Signer.h"
 #include "catapult/io/SeekableStream.h"
 #include <memory>
 
@@ -35,6 +36,7 @@ namespace catapult { namespace crypto {
 
 	private:
 		BmPrivateKeyTree(io::SeekableStream& storage, const BmOptions& options);
+		BmPrivateKeyTree(std::unique_ptr<io::SeekableStream>&& pStorage, const BmOptions& options);
 
 	public:
 		/// Move constructor.
@@ -48,6 +50,9 @@ namespace catapult { namespace crypto {
 		/// Creates a tree around \a storage.
 		static BmPrivateKeyTree FromStream(io::SeekableStream& storage);
 
+		/// Creates a tree around \a pStorage that is owned by the tree.
+		static BmPrivateKeyTree FromStream(std::unique_ptr<io::SeekableStream>&& pStorage);
+
 		/// Creates a tree around \a keyPair, \a storage and \a options.
 		static BmPrivateKeyTree Create(BmKeyPair&& keyPair, io::SeekableStream& storage, const BmOptions& options);
 
@@ -77,7 +82,10 @@ namespace catapult { namespace crypto {
 		void createLevel(size_t depth, BmKeyPair&& keyPair, uint64_t startIdentifier, uint64_t endIdentifier);
 		void wipe(size_t depth, uint64_t identifier);
 
+		void load();
+
 	private:
+		std::unique_ptr<io::SeekableStream> m_pStorage;
 		io::SeekableStream& m_storage;
 		BmOptions m_options;
 
@@ -88,4 +96,21 @@ namespace catapult { namespace crypto {
 
 	/// Verifies \a signature of \a buffer at \a keyIdentifier.
 	bool Verify(const BmTreeSignature& signature, const BmKeyIdentifier& keyIdentifier, const RawBuffer& buffer);
+
+	/// Bm tree signature input.
+	struct BmTreeSignatureInput {
+		/// Signature.
+		const BmTreeSignature& Signature;
+
+		/// Key identifier.
+		BmKeyIdentifier KeyIdentifier;
+
+		/// Signed buffer.
+		RawBuffer Buffer;
+	};
+
+	/// Verifies that all \a count bm tree signatures pointed to by \a pSignatureInputs are valid.
+	/// \a randomFiller is used to generate random bytes.
+	/// Returns a vector of bools that indicates the verification result for each individual signature.
+	std::vector<bool> VerifyMulti(const RandomFiller& randomFiller, const BmTreeSignatureInput* pSignatureInputs, size_t count);
 }}
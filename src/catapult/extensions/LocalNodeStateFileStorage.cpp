@@ -23,6 +23,7 @@
 #include "LocalNodeChainScore.h"
 #include "LocalNodeStateRef.h"
 #include "NemesisBlockLoader.h"
+#include "catapult/cache/CacheChangesStorage.h"
 #include "catapult/cache/CacheStorage.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/SupplementalDataStorage.h"
@@ -34,7 +35,12 @@
 #include "catapult/io/FilesystemUtils.h"
 #include "catapult/io/IndexFile.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/ThreadGroup.h"
 #include "catapult/utils/StackLogger.h"
+#include "catapult/utils/StackTimer.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 
 namespace catapult { namespace extensions {
 
@@ -43,10 +49,48 @@ namespace catapult { namespace extensions {
 	namespace {
 		constexpr size_t Default_Loader_Batch_Size = 100'000;
 		constexpr auto Supplemental_Data_Filename = "supplemental.dat";
+		constexpr auto Delta_Snapshots_Directory_Name = "deltas";
+		constexpr auto Parent_Height_Filename = "parent_height.dat";
 
 		std::string GetStorageFilename(const cache::CacheStorage& storage) {
 			return storage.name() + ".dat";
 		}
+
+		std::string GetChangesStorageFilename(const cache::CacheChangesStorage& storage) {
+			return "changes_" + std::to_string(storage.id()) + ".dat";
+		}
+
+		config::CatapultDirectory GetDeltaSnapshotDirectory(const config::CatapultDirectory& directory, Height height) {
+			// zero pad height so that lexicographical and height ordering are the same
+			std::ostringstream buffer;
+			buffer << std::setfill('0') << std::setw(20) << height.unwrap();
+			return directory.dir(Delta_Snapshots_Directory_Name).dir(buffer.str());
+		}
+
+		std::vector<config::CatapultDirectory> FindDeltaSnapshotDirectories(const config::CatapultDirectory& directory) {
+			auto deltaSnapshotsPath = directory.path() / Delta_Snapshots_Directory_Name;
+			if (!std::filesystem::is_directory(deltaSnapshotsPath))
+				return {};
+
+			std::vector<std::filesystem::path> paths;
+			for (const auto& entry : std::filesystem::directory_iterator(deltaSnapshotsPath)) {
+				if (entry.is_directory())
+					paths.push_back(entry.path());
+			}
+
+			std::sort(paths.begin(), paths.end());
+
+			std::vector<config::CatapultDirectory> directories;
+			for (const auto& path : paths)
+				directories.emplace_back(path);
+
+			return directories;
+		}
+
+		config::CatapultDirectory GetLatestSnapshotDirectory(const config::CatapultDirectory& directory) {
+			auto deltaSnapshotDirectories = FindDeltaSnapshotDirectories(directory);
+			return deltaSnapshotDirectories.empty() ? directory : deltaSnapshotDirectories.back();
+		}
 	}
 
 	// endregion
@@ -59,6 +103,14 @@ namespace catapult { namespace extensions {
 
 	// endregion
 
+	// region CountStateDeltaSnapshots
+
+	size_t CountStateDeltaSnapshots(const config::CatapultDirectory& directory) {
+		return FindDeltaSnapshotDirectories(directory).size();
+	}
+
+	// endregion
+
 	// region LoadDependentStateFromDirectory
 
 	namespace {
@@ -66,14 +118,22 @@ namespace catapult { namespace extensions {
 			return io::BufferedInputFileStream(io::RawFile(directory.file(filename), io::OpenMode::Read_Only));
 		}
 
+		Height LoadChainHeight(const config::CatapultDirectory& directory) {
+			cache::SupplementalData supplementalData;
+			Height chainHeight;
+			auto inputStream = OpenInputStream(directory, Supplemental_Data_Filename);
+			cache::LoadSupplementalData(inputStream, supplementalData, chainHeight);
+			return chainHeight;
+		}
+
 		void LoadDependentStateFromDirectory(
 				const config::CatapultDirectory& directory,
 				cache::CatapultCache& cache,
 				cache::SupplementalData& supplementalData) {
-			// load supplemental data
+			// load supplemental data from most recent (base or differential) state
 			Height chainHeight;
 			{
-				auto inputStream = OpenInputStream(directory, Supplemental_Data_Filename);
+				auto inputStream = OpenInputStream(GetLatestSnapshotDirectory(directory), Supplemental_Data_Filename);
 				cache::LoadSupplementalData(inputStream, supplementalData, chainHeight);
 			}
 
@@ -94,6 +154,76 @@ namespace catapult { namespace extensions {
 	// region LoadStateFromDirectory
 
 	namespace {
+		void ApplyStateChanges(
+				const config::CatapultDirectory& directory,
+				const std::vector<std::unique_ptr<const cache::CacheChangesStorage>>& cacheChangesStorages) {
+			cache::CacheChanges::MemoryCacheChangesContainer loadedChanges;
+			for (const auto& pStorage : cacheChangesStorages) {
+				auto cacheId = pStorage->id();
+				if (loadedChanges.size() <= cacheId)
+					loadedChanges.resize(cacheId + 1);
+
+				auto inputStream = OpenInputStream(directory, GetChangesStorageFilename(*pStorage));
+				loadedChanges[cacheId] = pStorage->loadAll(inputStream);
+			}
+
+			auto changes = cache::CacheChanges(std::move(loadedChanges));
+			for (const auto& pStorage : cacheChangesStorages)
+				pStorage->apply(changes);
+		}
+
+		void CheckDeltaSnapshotsAreContiguous(
+				const config::CatapultDirectory& directory,
+				const std::vector<config::CatapultDirectory>& deltaSnapshotDirectories) {
+			// each snapshot must have been created on top of the state produced by the previous (base or differential) state
+			auto height = LoadChainHeight(directory);
+			for (const auto& deltaSnapshotDirectory : deltaSnapshotDirectories) {
+				auto parentHeight = Height(io::IndexFile(deltaSnapshotDirectory.file(Parent_Height_Filename)).get());
+				if (height != parentHeight) {
+					CATAPULT_THROW_RUNTIME_ERROR_2(
+							"differential state snapshot does not extend previous state (height, parent height)",
+							height,
+							parentHeight);
+				}
+
+				height = LoadChainHeight(deltaSnapshotDirectory);
+			}
+		}
+
+		void LoadAllStorages(
+				const config::CatapultDirectory& directory,
+				const std::vector<std::unique_ptr<cache::CacheStorage>>& storages) {
+			// sub caches are independent, so load them concurrently
+			auto numThreads = std::min<size_t>(storages.size(), std::max(1u, std::thread::hardware_concurrency()));
+
+			std::atomic<size_t> nextIndex(0);
+			std::mutex exceptionMutex;
+			std::exception_ptr pException;
+			{
+				thread::ThreadGroup threads;
+				for (auto i = 0u; i < numThreads; ++i) {
+					threads.spawn([&directory, &storages, &nextIndex, &exceptionMutex, &pException]() {
+						for (auto index = nextIndex++; index < storages.size(); index = nextIndex++) {
+							try {
+								auto& storage = *storages[index];
+								utils::StackTimer stopwatch;
+								auto inputStream = OpenInputStream(directory, GetStorageFilename(storage));
+								storage.loadAll(inputStream, Default_Loader_Batch_Size);
+								CATAPULT_LOG(debug) << "loaded " << storage.name() << " in " << stopwatch.millis() << "ms";
+							} catch (...) {
+								std::lock_guard<std::mutex> lock(exceptionMutex);
+								if (!pException)
+									pException = std::current_exception();
+							}
+						}
+					});
+				}
+			}
+
+			if (pException)
+				std::rethrow_exception(pException);
+		}
+
 		bool LoadStateFromDirectory(
 				const config::CatapultDirectory& directory,
 				cache::CatapultCache& cache,
@@ -103,12 +233,20 @@ namespace catapult { namespace extensions {
 
 			// 1. load cache data
 			utils::StackLogger stopwatch("load state", utils::LogLevel::important);
-			for (const auto& pStorage : cache.storages()) {
-				auto inputStream = OpenInputStream(directory, GetStorageFilename(*pStorage));
-				pStorage->loadAll(inputStream, Default_Loader_Batch_Size);
+			LoadAllStorages(directory, cache.storages());
+
+			// 2. apply differential state
+			auto deltaSnapshotDirectories = FindDeltaSnapshotDirectories(directory);
+			if (!deltaSnapshotDirectories.empty()) {
+				CATAPULT_LOG(info) << "applying " << deltaSnapshotDirectories.size() << " differential state snapshots";
+				CheckDeltaSnapshotsAreContiguous(directory, deltaSnapshotDirectories);
+
+				auto cacheChangesStorages = const_cast<const cache::CatapultCache&>(cache).changesStorages();
+				for (const auto& deltaSnapshotDirectory : deltaSnapshotDirectories)
+					ApplyStateChanges(deltaSnapshotDirectory, cacheChangesStorages);
 			}
 
-			// 2. load supplemental data
+			// 3. load supplemental data
 			LoadDependentStateFromDirectory(directory, cache, supplementalData);
 			return true;
 		}
@@ -190,7 +328,46 @@ namespace catapult { namespace extensions {
 		});
 	}
 
+	void LocalNodeStateSerializer::saveChanges(
+			const cache::CatapultCacheDelta& cacheDelta,
+			const std::vector<std::unique_ptr<const cache::CacheChangesStorage>>& cacheChangesStorages,
+			const model::ChainScore& score,
+			Height parentHeight,
+			Height height) const {
+		// 1. create directory if required and save parent height
+		auto deltaSnapshotDirectory = GetDeltaSnapshotDirectory(m_directory, height);
+		deltaSnapshotDirectory.createAll();
+		io::IndexFile(deltaSnapshotDirectory.file(Parent_Height_Filename)).set(parentHeight.unwrap());
+
+		// 2. save cache changes
+		auto changes = cache::CacheChanges(cacheDelta);
+		for (const auto& pStorage : cacheChangesStorages) {
+			auto outputStream = OpenOutputStream(deltaSnapshotDirectory, GetChangesStorageFilename(*pStorage));
+			pStorage->saveAll(changes, outputStream);
+		}
+
+		// 3. save supplemental data
+		cache::SupplementalData supplementalData{ cacheDelta.dependentState(), score };
+		auto outputStream = OpenOutputStream(deltaSnapshotDirectory, Supplemental_Data_Filename);
+		cache::SaveSupplementalData(supplementalData, height, outputStream);
+	}
+
 	void LocalNodeStateSerializer::moveTo(const config::CatapultDirectory& destinationDirectory) {
+		auto hasOnlyDifferentialState = !HasSerializedState(m_directory)
+				&& std::filesystem::exists(m_directory.path() / Delta_Snapshots_Directory_Name);
+		if (hasOnlyDifferentialState) {
+			// merge differential state into destination instead of replacing destination
+			auto destinationDeltaSnapshotsDirectory = destinationDirectory.dir(Delta_Snapshots_Directory_Name);
+			destinationDeltaSnapshotsDirectory.createAll();
+			for (const auto& deltaSnapshotDirectory : FindDeltaSnapshotDirectories(m_directory)) {
+				auto destinationPath = destinationDeltaSnapshotsDirectory.path() / deltaSnapshotDirectory.path().filename();
+				std::filesystem::rename(deltaSnapshotDirectory.path(), destinationPath);
+			}
+
+			std::filesystem::remove_all(m_directory.path());
+			return;
+		}
+
 		io::PurgeDirectory(destinationDirectory.str());
 		std::filesystem::remove(destinationDirectory.path());
 		std::filesystem::rename(m_directory.path(), destinationDirectory.path());
@@ -204,6 +381,20 @@ namespace catapult { namespace extensions {
 		void SetCommitStep(const config::CatapultDataDirectory& dataDirectory, consumers::CommitOperationStep step) {
 			io::IndexFile(dataDirectory.rootDir().file("commit_step.dat")).set(utils::to_underlying_type(step));
 		}
+
+		bool IsSerializedStateCurrent(
+				const config::CatapultDirectory& directory,
+				const config::NodeConfiguration& nodeConfig,
+				const cache::CatapultCache& cache) {
+			if (nodeConfig.EnableCacheDatabaseStorage || 0 == nodeConfig.MaxStateDeltaSnapshots || !HasSerializedState(directory))
+				return false;
+
+			// when there are too many differential state snapshots, fold them into a new base state
+			if (CountStateDeltaSnapshots(directory) >= nodeConfig.MaxStateDeltaSnapshots)
+				return false;
+
+			return cache.createView().height() == LoadChainHeight(GetLatestSnapshotDirectory(directory));
+		}
 	}
 
 	void SaveStateToDirectoryWithCheckpointing(
@@ -211,6 +402,11 @@ namespace catapult { namespace extensions {
 			const config::NodeConfiguration& nodeConfig,
 			const cache::CatapultCache& cache,
 			const model::ChainScore& score) {
+		if (IsSerializedStateCurrent(dataDirectory.dir("state"), nodeConfig, cache)) {
+			CATAPULT_LOG(info) << "skipping state saving because serialized state is current";
+			return;
+		}
+
 		SetCommitStep(dataDirectory, consumers::CommitOperationStep::Blocks_Written);
 
 		LocalNodeStateSerializer serializer(dataDirectory.dir("state.tmp"));
@@ -25,6 +25,7 @@
 
 namespace catapult {
 	namespace cache {
+		class CacheChangesStorage;
 		class CacheStorage;
 		class CatapultCache;
 		class CatapultCacheDelta;
@@ -50,10 +51,15 @@ namespace catapult { namespace extensions {
 	/// Returns \c true if serialized state is present in \a directory.
 	bool HasSerializedState(const config::CatapultDirectory& directory);
 
+	/// Gets the number of differential state snapshots in \a directory.
+	size_t CountStateDeltaSnapshots(const config::CatapultDirectory& directory);
+
 	/// Loads dependent state from \a directory and updates \a cache.
 	void LoadDependentStateFromDirectory(const config::CatapultDirectory& directory, cache::CatapultCache& cache);
 
 	/// Loads catapult state into \a stateRef from \a directory given \a pluginManager.
+	/// \note Any differential state snapshots are applied on top of the base state in height order.
+	///       Loading fails when the snapshots do not form a contiguous chain starting at the base state.
 	StateHeights LoadStateFromDirectory(
 			const config::CatapultDirectory& directory,
 			const LocalNodeStateRef& stateRef,
@@ -76,7 +82,17 @@ namespace catapult { namespace extensions {
 				const model::ChainScore& score,
 				Height height) const;
 
+		/// Saves differential state composed of the changes in \a cacheDelta, \a score and \a height using \a cacheChangesStorages.
+		/// \note Changes are relative to the most recently saved (base or differential) state, which is at \a parentHeight.
+		void saveChanges(
+				const cache::CatapultCacheDelta& cacheDelta,
+				const std::vector<std::unique_ptr<const cache::CacheChangesStorage>>& cacheChangesStorages,
+				const model::ChainScore& score,
+				Height parentHeight,
+				Height height) const;
+
 		/// Moves serialized state to \a destinationDirectory.
+		/// \note When only differential state is serialized, it is merged into \a destinationDirectory instead of replacing it.
 		void moveTo(const config::CatapultDirectory& destinationDirectory);
 
 	private:
@@ -84,6 +100,7 @@ namespace catapult { namespace extensions {
 	};
 
 	/// Serializes state composed of \a cache and \a score with checkpointing to \a dataDirectory given \a nodeConfig.
+	/// \note Saving is skipped when differential state snapshots are enabled and the serialized state is already current.
 	void SaveStateToDirectoryWithCheckpointing(
 			const config::CatapultDataDirectory& dataDirectory,
 			const config::NodeConfiguration& nodeConfig,
@@ -23,6 +23,8 @@
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/exceptions.h"
+#include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <sstream>
 
@@ -42,11 +44,59 @@ namespace catapult { namespace io {
 			return true;
 		}
 
-		std::string GetFilename(uint64_t value) {
+		constexpr auto Segment_Extension = ".seg";
+
+		// size prefix written after the last message of a closed segment
+		constexpr uint32_t End_Of_Segment_Marker = 0xFFFF'FFFF;
+
+		std::string GetFilename(uint64_t value, const char* extension = ".dat") {
 			std::ostringstream out;
-			out << utils::HexFormat(value) << ".dat";
+			out << utils::HexFormat(value) << extension;
 			return out.str();
 		}
+
+		std::string GetSegmentFilename(uint64_t value) {
+			return GetFilename(value, Segment_Extension);
+		}
+
+		bool TryParseSegmentFirstIndex(const std::filesystem::path& path, uint64_t& firstIndex) {
+			auto stem = path.stem().generic_string();
+			if (Segment_Extension != path.extension() || 2 * sizeof(uint64_t) != stem.size())
+				return false;
+
+			std::istringstream in(stem);
+			in >> std::hex >> firstIndex;
+			return !in.fail();
+		}
+
+		std::filesystem::path FindSegmentContaining(const std::filesystem::path& directory, uint64_t index, uint64_t& segmentFirstIndex) {
+			std::filesystem::path segmentPath;
+			for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+				uint64_t firstIndex;
+				if (!TryParseSegmentFirstIndex(entry.path(), firstIndex) || firstIndex > index)
+					continue;
+
+				if (segmentPath.empty() || firstIndex > segmentFirstIndex) {
+					segmentFirstIndex = firstIndex;
+					segmentPath = entry.path();
+				}
+			}
+
+			return segmentPath;
+		}
+
+		std::vector<uint8_t> ReadAllContents(const std::string& filename) {
+			RawFile outputFile(filename, OpenMode::Read_Only);
+			std::vector<uint8_t> buffer(outputFile.size());
+			outputFile.read(buffer);
+			return buffer;
+		}
+
+		uint32_t ReadMessageSize(RawFile& segmentFile) {
+			uint32_t messageSize;
+			segmentFile.read({ reinterpret_cast<uint8_t*>(&messageSize), sizeof(uint32_t) });
+			return messageSize;
+		}
 	}
 
 	// region FileQueueWriter
@@ -55,12 +105,42 @@ namespace catapult { namespace io {
 	{}
 
 	FileQueueWriter::FileQueueWriter(const std::string& directory, const std::string& indexFilename)
+			: FileQueueWriter(directory, indexFilename, 0)
+	{}
+
+	FileQueueWriter::FileQueueWriter(const std::string& directory, const std::string& indexFilename, uint64_t maxSegmentSize)
+			: FileQueueWriter(directory, indexFilename, FileQueueSegmentOptions{ maxSegmentSize, 0, utils::TimeSpan() })
+	{}
+
+	FileQueueWriter::FileQueueWriter(
+			const std::string& directory,
+			const std::string& indexFilename,
+			const FileQueueSegmentOptions& segmentOptions)
 			: m_directory(CreateDirectory(directory))
 			, m_indexFile((m_directory / indexFilename).generic_string(), LockMode::None)
 			, m_indexValue(CreateIfNotExists(m_indexFile) ? 0 : m_indexFile.get())
-	{}
+			, m_segmentOptions(segmentOptions)
+			, m_numPendingMessages(0)
+			, m_pendingSize(0) {
+		if (0 != m_segmentOptions.MaxSegmentSize)
+			resumeSegment();
+	}
+
+	FileQueueWriter::~FileQueueWriter() {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		commitPending();
+	}
 
 	void FileQueueWriter::write(const RawBuffer& buffer) {
+		if (0 != m_segmentOptions.MaxSegmentSize) {
+			// reserve space for message size, which is only known at flush
+			if (m_messageBuffer.empty())
+				m_messageBuffer.resize(sizeof(uint32_t));
+
+			m_messageBuffer.insert(m_messageBuffer.end(), buffer.pData, buffer.pData + buffer.Size);
+			return;
+		}
+
 		if (!m_pOutputStream) {
 			auto filename = (m_directory / GetFilename(m_indexValue)).generic_string();
 			RawFile outputFile(filename, OpenMode::Read_Write);
@@ -71,6 +151,11 @@ namespace catapult { namespace io {
 	}
 
 	void FileQueueWriter::flush() {
+		if (0 != m_segmentOptions.MaxSegmentSize) {
+			flushToSegment();
+			return;
+		}
+
 		if (!m_pOutputStream)
 			return;
 
@@ -79,19 +164,103 @@ namespace catapult { namespace io {
 		m_indexValue = m_indexFile.increment();
 	}
 
-	// endregion
+	void FileQueueWriter::commitExpired() {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		if (0 != m_numPendingMessages && isPendingDurationExceeded())
+			commitPending();
+	}
 
-	// region FileQueueReader
+	void FileQueueWriter::resumeSegment() {
+		uint64_t segmentFirstIndex;
+		auto segmentPath = FindSegmentContaining(m_directory, m_indexValue, segmentFirstIndex);
+		if (segmentPath.empty())
+			return;
 
-	namespace {
-		std::vector<uint8_t> ReadAllContents(const std::string& filename) {
-			RawFile outputFile(filename, OpenMode::Read_Only);
-			std::vector<uint8_t> buffer(outputFile.size());
-			outputFile.read(buffer);
-			return buffer;
+		// segments are only started after all preceding messages are committed, so the last segment contains the next message;
+		// any data following the last committed message was never visible to readers and is overwritten
+		auto segmentContents = ReadAllContents(segmentPath.generic_string());
+		uint64_t offset = 0;
+		for (auto index = segmentFirstIndex; index < m_indexValue; ++index) {
+			uint32_t messageSize;
+			if (offset + sizeof(uint32_t) > segmentContents.size())
+				CATAPULT_THROW_RUNTIME_ERROR_1("segment does not contain all committed messages", segmentPath);
+
+			std::memcpy(&messageSize, &segmentContents[offset], sizeof(uint32_t));
+			offset += sizeof(uint32_t) + messageSize;
 		}
+
+		if (offset > segmentContents.size())
+			CATAPULT_THROW_RUNTIME_ERROR_1("segment does not contain all committed messages", segmentPath);
+
+		m_pSegmentFile = std::make_unique<RawFile>(segmentPath.generic_string(), OpenMode::Read_Append, LockMode::None);
+		m_pSegmentFile->seek(offset);
+		m_pSegmentFile->truncate();
+
+		if (m_pSegmentFile->position() >= m_segmentOptions.MaxSegmentSize)
+			closeSegment();
+	}
+
+	void FileQueueWriter::flushToSegment() {
+		if (m_messageBuffer.empty())
+			return;
+
+		std::lock_guard<std::mutex> guard(m_mutex);
+
+		// segment is named after its first message, so stale data from an interrupted writer is never read
+		if (!m_pSegmentFile) {
+			auto filename = (m_directory / GetSegmentFilename(m_indexValue)).generic_string();
+			m_pSegmentFile = std::make_unique<RawFile>(filename, OpenMode::Read_Write, LockMode::None);
+		}
+
+		// message must be completely written before it is made visible to readers by index update
+		auto messageSize = static_cast<uint32_t>(m_messageBuffer.size() - sizeof(uint32_t));
+		std::memcpy(m_messageBuffer.data(), &messageSize, sizeof(uint32_t));
+		m_pSegmentFile->write(m_messageBuffer);
+		m_messageBuffer.clear();
+
+		if (0 == m_numPendingMessages)
+			m_pendingStartTime = Clock::now();
+
+		++m_numPendingMessages;
+		m_pendingSize += sizeof(uint32_t) + messageSize;
+
+		if (m_pSegmentFile->position() >= m_segmentOptions.MaxSegmentSize) {
+			// next segment is named after the next index, so all messages in this segment need to be committed first
+			commitPending();
+			closeSegment();
+			return;
+		}
+
+		if (m_pendingSize >= m_segmentOptions.MaxPendingSize || isPendingDurationExceeded())
+			commitPending();
+	}
+
+	bool FileQueueWriter::isPendingDurationExceeded() const {
+		return Clock::now() - m_pendingStartTime >= std::chrono::milliseconds(m_segmentOptions.MaxPendingDuration.millis());
 	}
 
+	void FileQueueWriter::closeSegment() {
+		// readers switch to the segment named after the next message when they reach the marker
+		auto marker = End_Of_Segment_Marker;
+		m_pSegmentFile->write({ reinterpret_cast<const uint8_t*>(&marker), sizeof(uint32_t) });
+		m_pSegmentFile.reset();
+	}
+
+	void FileQueueWriter::commitPending() {
+		if (0 == m_numPendingMessages)
+			return;
+
+		m_indexValue += m_numPendingMessages;
+		m_indexFile.set(m_indexValue);
+
+		m_numPendingMessages = 0;
+		m_pendingSize = 0;
+	}
+
+	// endregion
+
+	// region FileQueueReader
+
 	FileQueueReader::FileQueueReader(const std::string& directory) : FileQueueReader(directory, "index_reader.dat", "index.dat")
 	{}
 
@@ -101,7 +270,8 @@ namespace catapult { namespace io {
 			const std::string& writerIndexFilename)
 			: m_directory(CreateDirectory(directory))
 			, m_readerIndexFile((m_directory / readerIndexFilename).generic_string())
-			, m_writerIndexFile((m_directory / writerIndexFilename).generic_string(), LockMode::None) {
+			, m_writerIndexFile((m_directory / writerIndexFilename).generic_string(), LockMode::None)
+			, m_minRetainedSegmentFirstIndex(0) {
 		CreateIfNotExists(m_readerIndexFile);
 	}
 
@@ -119,36 +289,187 @@ namespace catapult { namespace io {
 	}
 
 	bool FileQueueReader::tryReadNextMessageConditional(const predicate<const std::vector<uint8_t>&>& predicate) {
-		return process([predicate](const auto& nextMessageFilename) {
-			auto buffer = ReadAllContents(nextMessageFilename);
-			return predicate(buffer);
+		return tryReadNextMessages(1, [predicate](const auto& buffers) {
+			return predicate(buffers[0]);
+		});
+	}
+
+	bool FileQueueReader::tryReadNextMessages(size_t maxMessages, const predicate<const std::vector<std::vector<uint8_t>>&>& predicate) {
+		return process(maxMessages, true, [predicate](const auto& buffers) {
+			return predicate(buffers) ? buffers.size() : 0u;
 		});
 	}
 
+	bool FileQueueReader::tryReadNextMessagesPartial(size_t maxMessages, const MessagesProcessor& processMessages) {
+		return process(maxMessages, true, processMessages);
+	}
+
 	void FileQueueReader::skip(uint32_t count) {
-		for (auto i = 0u; i < count; ++i) {
-			process([](const auto&) {
-				return true;
-			});
-		}
+		process(count, false, [](const auto& buffers) {
+			return buffers.size();
+		});
 	}
 
-	bool FileQueueReader::process(const predicate<const std::string&>& processFilename) {
+	bool FileQueueReader::process(size_t maxMessages, bool shouldReadMessages, const MessagesProcessor& processMessages) {
 		auto readerIndexValue = m_readerIndexFile.get();
-		if (!m_writerIndexFile.exists() || readerIndexValue >= m_writerIndexFile.get())
+		if (0 == maxMessages || !m_writerIndexFile.exists())
+			return false;
+
+		auto writerIndexValue = m_writerIndexFile.get();
+		if (readerIndexValue >= writerIndexValue)
 			return false;
 
-		auto nextMessageFilename = m_directory / GetFilename(readerIndexValue);
-		if (!std::filesystem::exists(nextMessageFilename))
-			CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing message file", nextMessageFilename);
+		auto numMessages = std::min<uint64_t>(maxMessages, writerIndexValue - readerIndexValue);
+
+		auto originalSegmentCursor = m_segmentCursor;
+		std::vector<std::vector<uint8_t>> buffers;
+		std::vector<std::filesystem::path> messageFilenames;
+		std::vector<size_t> numMessageFilenames; // number of message files read up to and including each message
+		buffers.reserve(numMessages);
+		numMessageFilenames.reserve(numMessages);
+		size_t numProcessedMessages = 0;
+		try {
+			for (auto i = 0u; i < numMessages; ++i) {
+				buffers.push_back(readMessage(readerIndexValue + i, shouldReadMessages, messageFilenames));
+				numMessageFilenames.push_back(messageFilenames.size());
+			}
+
+			numProcessedMessages = std::min<size_t>(processMessages(buffers), buffers.size());
+		} catch (...) {
+			restoreSegmentCursor(originalSegmentCursor);
+			throw;
+		}
+
+		if (numProcessedMessages < numMessages) {
+			// unprocessed messages are not consumed, so the next read needs to find the first one again
+			restoreSegmentCursor(originalSegmentCursor);
+			if (0 == numProcessedMessages)
+				return false;
+		}
+
+		m_readerIndexFile.set(readerIndexValue + numProcessedMessages);
+		for (auto i = 0u; i < numMessageFilenames[numProcessedMessages - 1]; ++i)
+			std::filesystem::remove(messageFilenames[i]);
+
+		removeConsumedSegments();
+		return numProcessedMessages == numMessages;
+	}
+
+	std::vector<uint8_t> FileQueueReader::readMessage(
+			uint64_t index,
+			bool shouldReadMessage,
+			std::vector<std::filesystem::path>& messageFilenames) {
+		// file system only needs to be queried when message is not the next message in the active segment
+		if (!m_pSegmentFile || index != m_segmentCursor.NextIndex) {
+			auto messageFilename = m_directory / GetFilename(index);
+			if (std::filesystem::exists(messageFilename)) {
+				messageFilenames.push_back(messageFilename);
+				return shouldReadMessage ? ReadAllContents(messageFilename.generic_string()) : std::vector<uint8_t>();
+			}
+
+			if (!trySeekSegment(index))
+				CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing message file", messageFilename);
+		}
 
-		if (!processFilename(nextMessageFilename.generic_string()))
-			return false; // file was not fully processed, so don't delete it
+		auto messageSize = readSegmentMessageSize(index);
+
+		std::vector<uint8_t> buffer;
+		if (shouldReadMessage) {
+			buffer.resize(messageSize);
+			m_pSegmentFile->read(buffer);
+		}
+
+		m_segmentCursor.Offset += sizeof(uint32_t) + messageSize;
+		++m_segmentCursor.NextIndex;
+		return buffer;
+	}
+
+	uint32_t FileQueueReader::readSegmentMessageSize(uint64_t index) {
+		if (m_pSegmentFile->position() != m_segmentCursor.Offset) {
+			// cached file size is stale when segment has grown since it was opened
+			if (m_segmentCursor.Offset > m_pSegmentFile->size())
+				m_pSegmentFile = std::make_unique<RawFile>(m_segmentCursor.Path.generic_string(), OpenMode::Read_Only, LockMode::None);
+
+			m_pSegmentFile->seek(m_segmentCursor.Offset);
+		}
+
+		auto messageSize = ReadMessageSize(*m_pSegmentFile);
+		if (End_Of_Segment_Marker != messageSize)
+			return messageSize;
+
+		// message is first message in next segment
+		auto segmentPath = m_directory / GetSegmentFilename(index);
+		if (!std::filesystem::exists(segmentPath))
+			CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing segment file", segmentPath);
+
+		switchSegment(segmentPath, index);
+		return ReadMessageSize(*m_pSegmentFile);
+	}
+
+	bool FileQueueReader::trySeekSegment(uint64_t index) {
+		// message starts a new segment
+		auto segmentPath = m_directory / GetSegmentFilename(index);
+		if (std::filesystem::exists(segmentPath)) {
+			switchSegment(segmentPath, index);
+			return true;
+		}
+
+		// find segment containing message (e.g. after reader restart)
+		uint64_t segmentFirstIndex;
+		segmentPath = FindSegmentContaining(m_directory, index, segmentFirstIndex);
+		if (segmentPath.empty())
+			return false;
+
+		switchSegment(segmentPath, segmentFirstIndex);
+		while (m_segmentCursor.NextIndex < index) {
+			auto messageSize = ReadMessageSize(*m_pSegmentFile);
+			if (End_Of_Segment_Marker == messageSize)
+				return false;
+
+			m_segmentCursor.Offset += sizeof(uint32_t) + messageSize;
+			++m_segmentCursor.NextIndex;
+			m_pSegmentFile->seek(m_segmentCursor.Offset);
+		}
 
-		m_readerIndexFile.increment();
-		std::filesystem::remove(nextMessageFilename);
 		return true;
 	}
 
+	void FileQueueReader::switchSegment(const std::filesystem::path& segmentPath, uint64_t firstIndex) {
+		m_pSegmentFile = std::make_unique<RawFile>(segmentPath.generic_string(), OpenMode::Read_Only, LockMode::None);
+		m_segmentCursor.Path = segmentPath;
+		m_segmentCursor.FirstIndex = firstIndex;
+		m_segmentCursor.NextIndex = firstIndex;
+		m_segmentCursor.Offset = 0;
+	}
+
+	void FileQueueReader::restoreSegmentCursor(const SegmentCursor& segmentCursor) {
+		if (segmentCursor.Path != m_segmentCursor.Path) {
+			m_pSegmentFile = segmentCursor.Path.empty()
+					? nullptr
+					: std::make_unique<RawFile>(segmentCursor.Path.generic_string(), OpenMode::Read_Only, LockMode::None);
+		}
+
+		// file position is corrected by next read
+		m_segmentCursor = segmentCursor;
+	}
+
+	void FileQueueReader::removeConsumedSegments() {
+		if (m_segmentCursor.Path.empty() || m_segmentCursor.FirstIndex <= m_minRetainedSegmentFirstIndex)
+			return;
+
+		// all messages in segments preceding the active segment have been consumed, so they can be deleted
+		std::vector<std::filesystem::path> consumedSegmentPaths;
+		for (const auto& entry : std::filesystem::directory_iterator(m_directory)) {
+			uint64_t firstIndex;
+			if (TryParseSegmentFirstIndex(entry.path(), firstIndex) && firstIndex < m_segmentCursor.FirstIndex)
+				consumedSegmentPaths.push_back(entry.path());
+		}
+
+		for (const auto& consumedSegmentPath : consumedSegmentPaths)
+			std::filesystem::remove(consumedSegmentPath);
+
+		m_minRetainedSegmentFirstIndex = m_segmentCursor.FirstIndex;
+	}
+
 	// endregion
 }}
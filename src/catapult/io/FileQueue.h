@@ -22,13 +22,33 @@
 #pragma once
 #include "BufferedFileStream.h"
 #include "IndexFile.h"
+#include "catapult/utils/TimeSpan.h"
 #include "catapult/functions.h"
+#include <chrono>
 #include <filesystem>
+#include <mutex>
 
 namespace catapult { namespace io {
 
+	/// Options for a file queue writer with segments.
+	struct FileQueueSegmentOptions {
+		/// Maximum (approximate) size of a segment file.
+		/// \note Segments are disabled when zero.
+		uint64_t MaxSegmentSize = 0;
+
+		/// Total size of flushed messages that triggers a (group) commit making them visible to readers.
+		/// \note Every flush is committed when zero.
+		uint64_t MaxPendingSize = 0;
+
+		/// Maximum time a flushed message is kept uncommitted, which is checked by flush and commitExpired.
+		utils::TimeSpan MaxPendingDuration;
+	};
+
 	/// File based queue writer where each message is represented by a file (with incrementing names) in a directory.
-	/// \note Each call to flush will additionally create a new file.
+	/// \note Each call to flush will additionally create a new file unless segments are enabled.
+	/// When segments are enabled, each call to flush appends a (size prefixed) message to the active segment file,
+	/// which is named after its first message and is closed with an end marker once it exceeds the maximum segment size.
+	/// Appended messages are made visible to readers by a single index update per group commit.
 	class FileQueueWriter final : public OutputStream {
 	public:
 		/// Creates a file queue writer around \a directory.
@@ -37,19 +57,59 @@ namespace catapult { namespace io {
 		/// Creates a file queue writer around \a directory containing a (writer) index file (\a indexFilename).
 		FileQueueWriter(const std::string& directory, const std::string& indexFilename);
 
+		/// Creates a file queue writer around \a directory containing a (writer) index file (\a indexFilename)
+		/// with segments of (approximately) \a maxSegmentSize bytes and a commit per flush.
+		/// \note Segments are disabled when \a maxSegmentSize is zero.
+		FileQueueWriter(const std::string& directory, const std::string& indexFilename, uint64_t maxSegmentSize);
+
+		/// Creates a file queue writer around \a directory containing a (writer) index file (\a indexFilename)
+		/// with segments configured by \a segmentOptions.
+		FileQueueWriter(const std::string& directory, const std::string& indexFilename, const FileQueueSegmentOptions& segmentOptions);
+
+		/// Destroys the writer and commits all flushed messages.
+		~FileQueueWriter() override;
+
 	public:
 		void write(const RawBuffer& buffer) override;
 		void flush() override;
 
+		/// Commits all flushed messages if the oldest one has been pending for at least the maximum pending duration.
+		/// \note This is the only writer function that can be called concurrently with other writer functions.
+		void commitExpired();
+
 	private:
+		void resumeSegment();
+		void flushToSegment();
+		void closeSegment();
+		bool isPendingDurationExceeded() const;
+		void commitPending();
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
 		std::filesystem::path m_directory;
 		IndexFile m_indexFile;
 		uint64_t m_indexValue;
+		FileQueueSegmentOptions m_segmentOptions;
 		std::unique_ptr<BufferedOutputFileStream> m_pOutputStream;
+		std::unique_ptr<RawFile> m_pSegmentFile;
+		std::vector<uint8_t> m_messageBuffer;
+
+		// flushed segment messages that are not yet visible to readers
+		uint64_t m_numPendingMessages;
+		uint64_t m_pendingSize;
+		Clock::time_point m_pendingStartTime;
+		std::mutex m_mutex;
 	};
 
 	/// File based queue reader where each message is represented by a file (with incrementing names) in a directory.
+	/// \note Messages appended to segment files by a segment enabled writer are supported too.
+	/// The active segment file is kept open, so a long lived reader reads consecutive segment messages without reopening it.
 	class FileQueueReader final {
+	public:
+		/// Processes messages and returns the number of leading messages that were processed.
+		using MessagesProcessor = std::function<size_t (const std::vector<std::vector<uint8_t>>&)>;
+
 	public:
 		/// Creates a file queue reader around \a directory.
 		explicit FileQueueReader(const std::string& directory);
@@ -70,15 +130,47 @@ namespace catapult { namespace io {
 		/// When \a predicate returns \c false, processing is stopped and message is not consumed.
 		bool tryReadNextMessageConditional(const predicate<const std::vector<uint8_t>&>& predicate);
 
+		/// Tries to read at most the next \a maxMessages messages and forwards them to \a predicate if successful.
+		/// When \a predicate returns \c false, processing is stopped and none of the messages are consumed.
+		bool tryReadNextMessages(size_t maxMessages, const predicate<const std::vector<std::vector<uint8_t>>&>& predicate);
+
+		/// Tries to read at most the next \a maxMessages messages and forwards them to \a processMessages if successful.
+		/// Only the leading messages reported as processed by \a processMessages are consumed.
+		/// Returns \c true when all read messages are consumed.
+		bool tryReadNextMessagesPartial(size_t maxMessages, const MessagesProcessor& processMessages);
+
 		/// Skips at most the next \a count messages.
 		void skip(uint32_t count);
 
 	private:
-		bool process(const predicate<const std::string&>& processFilename);
+		struct SegmentCursor {
+			std::filesystem::path Path;
+			uint64_t FirstIndex = 0;
+			uint64_t NextIndex = 0;
+			uint64_t Offset = 0;
+		};
+
+	private:
+		bool process(size_t maxMessages, bool shouldReadMessages, const MessagesProcessor& processMessages);
+
+		std::vector<uint8_t> readMessage(uint64_t index, bool shouldReadMessage, std::vector<std::filesystem::path>& messageFilenames);
+		uint32_t readSegmentMessageSize(uint64_t index);
+
+		bool trySeekSegment(uint64_t index);
+		void switchSegment(const std::filesystem::path& segmentPath, uint64_t firstIndex);
+		void restoreSegmentCursor(const SegmentCursor& segmentCursor);
+		void removeConsumedSegments();
 
 	private:
 		std::filesystem::path m_directory;
 		IndexFile m_readerIndexFile;
 		IndexFile m_writerIndexFile;
+
+		// position of next message in active segment, which is kept open across reads
+		SegmentCursor m_segmentCursor;
+		std::unique_ptr<RawFile> m_pSegmentFile;
+
+		// all segments starting before this index have been removed
+		uint64_t m_minRetainedSegmentFirstIndex;
 	};
 }}
@@ -37,6 +37,9 @@
 namespace catapult { namespace local {
 
 	namespace {
+		// maximum number of spooled messages dispatched to subscribers before they are flushed and the messages are consumed
+		constexpr size_t Max_Ingestion_Batch_Size = 250;
+
 		class DefaultBroker final : public Broker {
 		public:
 			explicit DefaultBroker(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper)
@@ -100,9 +103,11 @@ namespace catapult { namespace local {
 				task.NextDelay = thread::CreateUniformDelayGenerator(utils::TimeSpan::FromMilliseconds(500));
 				task.Name = queueName;
 
+				// reader is shared by all task invocations, so consecutive polls continue in the open queue segment
 				auto queuePath = m_dataDirectory.spoolDir(queueName).str();
-				task.Callback = [&subscriber, readNextMessage, queuePath]() {
-					subscribers::ReadAll({ queuePath, "index_broker_r.dat", "index.dat" }, subscriber, readNextMessage);
+				auto pReader = std::make_shared<io::FileQueueReader>(queuePath, "index_broker_r.dat", "index.dat");
+				task.Callback = [&subscriber, readNextMessage, queuePath, pReader]() {
+					subscribers::ReadAllPending(*pReader, queuePath, subscriber, readNextMessage, Max_Ingestion_Batch_Size);
 					return thread::make_ready_future(thread::TaskResult::Continue);
 				};
 
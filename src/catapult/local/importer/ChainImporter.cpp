@@ -133,6 +133,9 @@ namespace catapult { namespace local {
 					m_pStateChangeSubscriber->notifyStateChange(loadedBlockStatus.StateChangeInfo);
 				});
 
+				if (m_pBlockChangeSubscriber)
+					m_pBlockChangeSubscriber->flush();
+
 				// fix up index
 				auto stateChangeDir = m_dataDirectory.spoolDir("state_change");
 				std::filesystem::copy(stateChangeDir.file("index_server.dat"), stateChangeDir.file("index.dat"));
@@ -33,6 +33,9 @@
 #include "catapult/plugins/PluginManager.h"
 #include "catapult/subscribers/StateChangeInfo.h"
 #include "catapult/utils/StackLogger.h"
+#include <condition_variable>
+#include <deque>
+#include <thread>
 
 namespace catapult { namespace local {
 
@@ -105,10 +108,127 @@ namespace catapult { namespace local {
 		};
 	}
 
+	namespace {
+		using Clock = std::chrono::steady_clock;
+
+		uint64_t ElapsedMicros(Clock::time_point start) {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count());
+		}
+
+		uint64_t BlocksPerSecond(uint64_t numBlocks, uint64_t micros) {
+			return 0 == micros ? numBlocks : numBlocks * 1'000'000 / micros;
+		}
+
+		/// Loads block elements from storage on a dedicated thread ahead of their execution.
+		class BlockElementReadAheadQueue {
+		public:
+			BlockElementReadAheadQueue(const io::BlockStorageCache& storage, Height startHeight, Height endHeight, size_t maxPendingBlocks)
+					: m_storage(storage)
+					, m_maxPendingBlocks(maxPendingBlocks)
+					, m_isStopped(false)
+					, m_numReadBlocks(0)
+					, m_readMicros(0)
+					, m_thread([this, startHeight, endHeight]() { readAll(startHeight, endHeight); })
+			{}
+
+			~BlockElementReadAheadQueue() {
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_isStopped = true;
+				}
+
+				m_notFullCondition.notify_one();
+				m_thread.join();
+			}
+
+		public:
+			/// Gets the number of blocks loaded by the read stage.
+			uint64_t numReadBlocks() const {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				return m_numReadBlocks;
+			}
+
+			/// Gets the number of microseconds spent by the read stage loading blocks.
+			uint64_t readMicros() const {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				return m_readMicros;
+			}
+
+		public:
+			/// Waits for and removes the next block element.
+			std::shared_ptr<const model::BlockElement> pop() {
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_notEmptyCondition.wait(lock, [this]() { return !m_blockElements.empty() || m_pException; });
+				if (m_blockElements.empty())
+					std::rethrow_exception(m_pException);
+
+				auto pBlockElement = std::move(m_blockElements.front());
+				m_blockElements.pop_front();
+				lock.unlock();
+
+				m_notFullCondition.notify_one();
+				return pBlockElement;
+			}
+
+		private:
+			void readAll(Height startHeight, Height endHeight) {
+				try {
+					for (auto height = startHeight; height <= endHeight; height = height + Height(1)) {
+						if (!waitUntilNotFull())
+							return;
+
+						auto start = Clock::now();
+						auto pBlockElement = m_storage.view().loadBlockElement(height);
+						auto readMicros = ElapsedMicros(start);
+
+						{
+							std::lock_guard<std::mutex> lock(m_mutex);
+							m_blockElements.push_back(std::move(pBlockElement));
+							++m_numReadBlocks;
+							m_readMicros += readMicros;
+						}
+
+						m_notEmptyCondition.notify_one();
+					}
+				} catch (...) {
+					{
+						std::lock_guard<std::mutex> lock(m_mutex);
+						m_pException = std::current_exception();
+					}
+
+					m_notEmptyCondition.notify_one();
+				}
+			}
+
+			bool waitUntilNotFull() {
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_notFullCondition.wait(lock, [this]() { return m_isStopped || m_blockElements.size() < m_maxPendingBlocks; });
+				return !m_isStopped;
+			}
+
+		private:
+			const io::BlockStorageCache& m_storage;
+			const size_t m_maxPendingBlocks;
+
+			mutable std::mutex m_mutex;
+			std::condition_variable m_notEmptyCondition;
+			std::condition_variable m_notFullCondition;
+			std::deque<std::shared_ptr<const model::BlockElement>> m_blockElements;
+			std::exception_ptr m_pException;
+			bool m_isStopped;
+			uint64_t m_numReadBlocks;
+			uint64_t m_readMicros;
+
+			std::thread m_thread; // must be last member because it accesses all other members
+		};
+	}
+
 	class BlockChainLoader {
 	private:
 		using NotifyProgressFunc = consumer<Height, Height>;
 
+		static constexpr size_t Max_Read_Ahead_Blocks = 16;
+
 	public:
 		BlockChainLoader(
 				const BlockDependentNotificationObserverFactory& observerFactory,
@@ -125,17 +245,29 @@ namespace catapult { namespace local {
 
 	public:
 		model::ChainScore loadAll(const NotifyProgressFunc& notifyProgress) const {
-			const auto& storage = m_stateRef.Storage.view();
+			std::shared_ptr<const model::BlockElement> pParentBlockElement;
+			Height chainHeight;
+			{
+				const auto& storage = m_stateRef.Storage.view();
+				pParentBlockElement = storage.loadBlockElement(m_startHeight - Height(1));
+				chainHeight = storage.chainHeight();
+			}
 
-			auto height = m_startHeight;
-			auto pParentBlockElement = storage.loadBlockElement(height - Height(1));
+			// blocks are read from storage on a separate thread so that execution never waits on I/O
+			BlockElementReadAheadQueue readAheadQueue(m_stateRef.Storage, m_startHeight, chainHeight, Max_Read_Ahead_Blocks);
 
 			model::ChainScore previousScore;
 			model::ChainScore score;
 			Hash256 stateHash;
-			auto chainHeight = storage.chainHeight();
+			uint64_t executeMicros = 0;
+			uint64_t waitMicros = 0;
+			auto height = m_startHeight;
 			while (chainHeight >= height) {
-				auto pBlockElement = storage.loadBlockElement(height);
+				auto waitStart = Clock::now();
+				auto pBlockElement = readAheadQueue.pop();
+				waitMicros += ElapsedMicros(waitStart);
+
+				auto executeStart = Clock::now();
 				score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
 
 				const auto& blockElement = *pBlockElement;
@@ -148,6 +280,7 @@ namespace catapult { namespace local {
 					auto stateChangeInfo = subscribers::StateChangeInfo{ std::move(cacheChanges), scoreDelta, blockElement.Block.Height };
 					statusConsumer(LoadedBlockStatus{ blockElement, score, stateChangeInfo });
 				});
+				executeMicros += ElapsedMicros(executeStart);
 				notifyProgress(height, chainHeight);
 
 				pParentBlockElement = std::move(pBlockElement);
@@ -159,6 +292,16 @@ namespace catapult { namespace local {
 				CATAPULT_LOG(info)
 						<< "cache state hash at height " << chainHeight << ": " << stateHash
 						<< " (loaded from height " << m_startHeight << ")";
+
+				auto numBlocks = chainHeight.unwrap() - m_startHeight.unwrap() + 1;
+				auto numReadBlocks = readAheadQueue.numReadBlocks();
+				auto readMicros = readAheadQueue.readMicros();
+				CATAPULT_LOG(info)
+						<< "read stage: " << numReadBlocks << " blocks in " << readMicros / 1000 << "ms ("
+						<< BlocksPerSecond(numReadBlocks, readMicros) << " blocks/s)"
+						<< ", execute stage: " << numBlocks << " blocks in " << executeMicros / 1000 << "ms ("
+						<< BlocksPerSecond(numBlocks, executeMicros) << " blocks/s)"
+						<< ", execution waited " << waitMicros / 1000 << "ms for reads";
 			}
 
 			return score;
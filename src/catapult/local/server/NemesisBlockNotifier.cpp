@@ -60,6 +60,7 @@ namespace catapult { namespace local {
 	void NemesisBlockNotifier::raise(io::BlockChangeSubscriber& subscriber) {
 		raise([&subscriber](const auto& nemesisBlockElement) {
 			subscriber.notifyBlock(nemesisBlockElement);
+			subscriber.flush();
 		});
 	}
 
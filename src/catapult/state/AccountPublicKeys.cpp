@@ -42,7 +42,7 @@ namespace catapult { namespace state {
 	template<typename TAccountPublicKey>
 	PUBLIC_KEY_ACCESSOR_T& PUBLIC_KEY_ACCESSOR_T::operator=(const PublicKeyAccessor& accessor) {
 		if (accessor.m_pKey)
-			m_pKey = std::make_shared<TAccountPublicKey>(*accessor.m_pKey);
+			m_pKey = std::make_unique<TAccountPublicKey>(*accessor.m_pKey);
 		else
 			m_pKey.reset();
 
@@ -67,7 +67,7 @@ namespace catapult { namespace state {
 		if (m_pKey)
 			CATAPULT_THROW_INVALID_ARGUMENT("must call unset before resetting key with value");
 
-		m_pKey = std::make_shared<TAccountPublicKey>(key);
+		m_pKey = std::make_unique<TAccountPublicKey>(key);
 	}
 
 	template<typename TAccountPublicKey>
@@ -94,11 +94,7 @@ namespace catapult { namespace state {
 
 	template<typename TPinnedAccountPublicKey>
 	PUBLIC_KEYS_ACCESSOR_T& PUBLIC_KEYS_ACCESSOR_T::operator=(const PublicKeysAccessor& accessor) {
-		if (accessor.m_pKeys)
-			m_pKeys = std::make_shared<std::vector<TPinnedAccountPublicKey>>(*accessor.m_pKeys);
-		else
-			m_pKeys.reset();
-
+		m_keys = accessor.m_keys;
 		return *this;
 	}
 
@@ -107,40 +103,37 @@ namespace catapult { namespace state {
 
 	template<typename TPinnedAccountPublicKey>
 	size_t PUBLIC_KEYS_ACCESSOR_T::size() const {
-		return m_pKeys ? m_pKeys->size() : 0;
+		return m_keys.size();
 	}
 
 	template<typename TPinnedAccountPublicKey>
 	FinalizationEpoch PUBLIC_KEYS_ACCESSOR_T::upperBound() const {
-		return m_pKeys ? m_pKeys->back().EndEpoch : FinalizationEpoch();
+		return m_keys.empty() ? FinalizationEpoch() : m_keys.back().EndEpoch;
 	}
 
 	template<typename TPinnedAccountPublicKey>
 	std::pair<size_t, bool> PUBLIC_KEYS_ACCESSOR_T::contains(FinalizationEpoch epoch) const {
-		if (!m_pKeys)
-			return std::make_pair(std::numeric_limits<size_t>::max(), false);
-
-		auto iter = std::find_if(m_pKeys->cbegin(), m_pKeys->cend(), [epoch](const auto& key) {
+		auto iter = std::find_if(m_keys.cbegin(), m_keys.cend(), [epoch](const auto& key) {
 			return key.StartEpoch <= epoch && epoch <= key.EndEpoch;
 		});
-		return m_pKeys->cend() == iter
+		return m_keys.cend() == iter
 				? std::make_pair(std::numeric_limits<size_t>::max(), false)
-				: std::make_pair(static_cast<size_t>(std::distance(m_pKeys->cbegin(), iter)), true);
+				: std::make_pair(static_cast<size_t>(std::distance(m_keys.cbegin(), iter)), true);
 	}
 
 	template<typename TPinnedAccountPublicKey>
 	bool PUBLIC_KEYS_ACCESSOR_T::containsExact(const TPinnedAccountPublicKey& key) const {
-		return m_pKeys && m_pKeys->cend() != findExact(key);
+		return m_keys.cend() != findExact(key);
 	}
 
 	template<typename TPinnedAccountPublicKey>
 	const TPinnedAccountPublicKey& PUBLIC_KEYS_ACCESSOR_T::get(size_t index) const {
-		return (*m_pKeys)[index];
+		return m_keys[index];
 	}
 
 	template<typename TPinnedAccountPublicKey>
 	std::vector<TPinnedAccountPublicKey> PUBLIC_KEYS_ACCESSOR_T::getAll() const {
-		return m_pKeys ? *m_pKeys : std::vector<TPinnedAccountPublicKey>();
+		return m_keys;
 	}
 
 	namespace {
@@ -173,37 +166,33 @@ namespace catapult { namespace state {
 
 	template<typename TPinnedAccountPublicKey>
 	void PUBLIC_KEYS_ACCESSOR_T::add(const TPinnedAccountPublicKey& key) {
-		if (!m_pKeys)
-			m_pKeys = std::make_shared<std::vector<TPinnedAccountPublicKey>>();
-
-		EnsureNoOverlap(*m_pKeys, key);
+		EnsureNoOverlap(m_keys, key);
 
 		// use an insertion sort to keep keys in deterministic order for serialization
-		auto iter = std::find_if(m_pKeys->cbegin(), m_pKeys->cend(), [&key](const auto& existingKey) {
+		auto iter = std::find_if(m_keys.cbegin(), m_keys.cend(), [&key](const auto& existingKey) {
 			return existingKey.StartEpoch > key.EndEpoch;
 		});
-		m_pKeys->insert(iter, key);
+		m_keys.insert(iter, key);
 	}
 
 	template<typename TPinnedAccountPublicKey>
 	bool PUBLIC_KEYS_ACCESSOR_T::remove(const TPinnedAccountPublicKey& key) {
-		if (!m_pKeys)
-			return false;
-
 		auto iter = findExact(key);
-		if (m_pKeys->cend() == iter)
+		if (m_keys.cend() == iter)
 			return false;
 
-		m_pKeys->erase(iter);
-		if (m_pKeys->empty())
-			m_pKeys.reset();
+		m_keys.erase(iter);
+
+		// release memory when the last key is removed
+		if (m_keys.empty())
+			m_keys = std::vector<TPinnedAccountPublicKey>();
 
 		return true;
 	}
 
 	template<typename TPinnedAccountPublicKey>
 	typename PUBLIC_KEYS_ACCESSOR_T::const_iterator PUBLIC_KEYS_ACCESSOR_T::findExact(const TPinnedAccountPublicKey& key) const {
-		return std::find_if(m_pKeys->cbegin(), m_pKeys->cend(), [&key](const auto& existingKey) {
+		return std::find_if(m_keys.cbegin(), m_keys.cend(), [&key](const auto& existingKey) {
 			return key.VotingKey == existingKey.VotingKey
 					&& key.StartEpoch == existingKey.StartEpoch
 					&& key.EndEpoch == existingKey.EndEpoch;
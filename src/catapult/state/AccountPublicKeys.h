@@ -90,7 +90,7 @@ namespace catapult { namespace state {
 			void unset();
 
 		private:
-			std::shared_ptr<TAccountPublicKey> m_pKey;
+			std::unique_ptr<TAccountPublicKey> m_pKey;
 		};
 
 		// endregion
@@ -150,7 +150,7 @@ namespace catapult { namespace state {
 			const_iterator findExact(const TPinnedAccountPublicKey& key) const;
 
 		private:
-			std::shared_ptr<std::vector<TPinnedAccountPublicKey>> m_pKeys;
+			std::vector<TPinnedAccountPublicKey> m_keys;
 		};
 
 		// endregion
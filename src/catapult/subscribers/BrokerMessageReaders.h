@@ -23,6 +23,7 @@
 #include "catapult/io/BufferInputStreamAdapter.h"
 #include "catapult/io/FileQueue.h"
 #include "catapult/utils/traits/Traits.h"
+#include <exception>
 
 namespace catapult { namespace subscribers {
 
@@ -45,25 +46,59 @@ namespace catapult { namespace subscribers {
 
 	// endregion
 
+	namespace detail {
+		template<typename TSubscriber, typename TMessageReader>
+		void ReadAllWithoutFlush(io::InputStream& inputStream, TSubscriber& subscriber, TMessageReader readNextMessage) {
+			while (!inputStream.eof())
+				readNextMessage(inputStream, subscriber);
+		}
+	}
+
 	/// Reads all messages from \a inputStream into \a subscriber using \a readNextMessage.
 	template<typename TSubscriber, typename TMessageReader>
 	void ReadAll(io::InputStream& inputStream, TSubscriber& subscriber, TMessageReader readNextMessage) {
-		while (!inputStream.eof())
-			readNextMessage(inputStream, subscriber);
-
+		detail::ReadAllWithoutFlush(inputStream, subscriber, readNextMessage);
 		detail::Flusher<TSubscriber>::Flush(subscriber);
 	}
 
-	/// Reads all messages from \a reader into \a subscriber using \a readNextMessage.
+	/// Reads all messages from \a reader into \a subscriber using \a readNextMessage in batches of at most \a maxBatchSize messages.
+	/// \note \a subscriber is flushed once per batch and batch messages are consumed only after they have been flushed.
+	///       When a message cannot be processed, \a subscriber is flushed and all preceding messages are consumed,
+	///       so at most the failed message is processed again (as when reading one message at a time).
 	template<typename TSubscriber, typename TMessageReader>
-	void ReadAll(io::FileQueueReader& reader, TSubscriber& subscriber, TMessageReader readNextMessage) {
-		bool shouldContinue = true;
-		while (shouldContinue) {
-			shouldContinue = reader.tryReadNextMessage([&subscriber, readNextMessage](const auto& buffer) {
-				io::BufferInputStreamAdapter<std::vector<uint8_t>> inputStream(buffer);
-				ReadAll(inputStream, subscriber, readNextMessage);
+	void ReadAll(io::FileQueueReader& reader, TSubscriber& subscriber, TMessageReader readNextMessage, size_t maxBatchSize) {
+		std::exception_ptr pException;
+		while (!pException) {
+			auto isBatchConsumed = reader.tryReadNextMessagesPartial(maxBatchSize, [&subscriber, readNextMessage, &pException](
+					const auto& buffers) {
+				size_t numProcessedMessages = 0;
+				try {
+					for (const auto& buffer : buffers) {
+						io::BufferInputStreamAdapter<std::vector<uint8_t>> inputStream(buffer);
+						detail::ReadAllWithoutFlush(inputStream, subscriber, readNextMessage);
+						++numProcessedMessages;
+					}
+				} catch (...) {
+					pException = std::current_exception();
+				}
+
+				// commit all processed messages, even when a later message failed, before they are consumed
+				detail::Flusher<TSubscriber>::Flush(subscriber);
+				return numProcessedMessages;
 			});
+
+			if (!isBatchConsumed)
+				break;
 		}
+
+		if (pException)
+			std::rethrow_exception(pException);
+	}
+
+	/// Reads all messages from \a reader into \a subscriber using \a readNextMessage.
+	template<typename TSubscriber, typename TMessageReader>
+	void ReadAll(io::FileQueueReader& reader, TSubscriber& subscriber, TMessageReader readNextMessage) {
+		ReadAll(reader, subscriber, readNextMessage, 1);
 	}
 
 	/// Describes a message queue.
@@ -78,16 +113,35 @@ namespace catapult { namespace subscribers {
 		std::string IndexWriterFilename;
 	};
 
-	/// Reads all messages from queue described by \a descriptor into \a subscriber using \a readNextMessage.
+	/// Reads all pending messages from \a reader of queue with path \a queuePath into \a subscriber using \a readNextMessage
+	/// in batches of at most \a maxBatchSize messages.
+	/// \note \a reader can be reused across calls, which allows it to keep its position in the active queue segment.
 	template<typename TSubscriber, typename TMessageReader>
-	void ReadAll(const MessageQueueDescriptor& descriptor, TSubscriber& subscriber, TMessageReader readNextMessage) {
-		io::FileQueueReader reader(descriptor.QueuePath, descriptor.IndexReaderFilename, descriptor.IndexWriterFilename);
-
+	void ReadAllPending(
+			io::FileQueueReader& reader,
+			const std::string& queuePath,
+			TSubscriber& subscriber,
+			TMessageReader readNextMessage,
+			size_t maxBatchSize) {
 		auto numPendingMessages = reader.pending();
 		if (0 == numPendingMessages)
 			return;
 
-		CATAPULT_LOG(debug) << "preparing to process " << numPendingMessages << " messages from " << descriptor.QueuePath;
-		subscribers::ReadAll(reader, subscriber, readNextMessage);
+		CATAPULT_LOG(debug) << "preparing to process " << numPendingMessages << " messages from " << queuePath;
+		subscribers::ReadAll(reader, subscriber, readNextMessage, maxBatchSize);
+	}
+
+	/// Reads all messages from queue described by \a descriptor into \a subscriber using \a readNextMessage
+	/// in batches of at most \a maxBatchSize messages.
+	template<typename TSubscriber, typename TMessageReader>
+	void ReadAll(const MessageQueueDescriptor& descriptor, TSubscriber& subscriber, TMessageReader readNextMessage, size_t maxBatchSize) {
+		io::FileQueueReader reader(descriptor.QueuePath, descriptor.IndexReaderFilename, descriptor.IndexWriterFilename);
+		ReadAllPending(reader, descriptor.QueuePath, subscriber, readNextMessage, maxBatchSize);
+	}
+
+	/// Reads all messages from queue described by \a descriptor into \a subscriber using \a readNextMessage.
+	template<typename TSubscriber, typename TMessageReader>
+	void ReadAll(const MessageQueueDescriptor& descriptor, TSubscriber& subscriber, TMessageReader readNextMessage) {
+		ReadAll(descriptor, subscriber, readNextMessage, 1);
 	}
 }}
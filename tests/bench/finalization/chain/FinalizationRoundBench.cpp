@@ -0,0 +1,429 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "finalization/src/chain/RoundContext.h"
+#include "finalization/src/chain/RoundMessageAggregator.h"
+#include "finalization/src/model/FinalizationContext.h"
+#include "finalization/src/model/FinalizationMessage.h"
+#include "finalization/src/model/FinalizationProofUtils.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/crypto_voting/VotingSigner.h"
+#include "catapult/model/VotingSet.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "catapult/utils/RandomGenerator.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <map>
+
+namespace catapult { namespace chain {
+
+	namespace {
+		using Messages = std::vector<std::shared_ptr<model::FinalizationMessage>>;
+		using Aggregators = std::vector<std::unique_ptr<RoundMessageAggregator>>;
+
+		constexpr auto Harvesting_Mosaic_Id = MosaicId(9876);
+		constexpr auto Voter_Balance = Amount(3'000'000);
+		constexpr uint64_t Voting_Set_Grouping = 720;
+		constexpr uint32_t Num_Prevote_Hashes = 10;
+		constexpr uint32_t Num_Epochs = 3;
+
+		// region utils
+
+		void SuppressTraceLogging() {
+			// the aggregator logs every added message at trace level, which would otherwise dominate the measurements
+			static auto pBootstrapper = [] {
+				auto pLoggingBootstrapper = std::make_unique<utils::LoggingBootstrapper>();
+				pLoggingBootstrapper->addConsoleLogger(utils::BasicLoggerOptions(), utils::LogFilter(utils::LogLevel::warning));
+				return pLoggingBootstrapper;
+			}();
+		}
+
+		crypto::VotingKeyPair GenerateVotingKeyPair() {
+			return crypto::VotingKeyPair::FromPrivate(crypto::VotingPrivateKey::Generate(bench::RandomByte));
+		}
+
+		crypto::RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				utils::HighEntropyRandomGenerator().fill(pOut, count);
+			};
+		}
+
+		finalization::FinalizationConfiguration CreateConfiguration() {
+			auto config = finalization::FinalizationConfiguration::Uninitialized();
+			config.Size = 10'000;
+			config.Threshold = 6'700;
+			config.MessageSynchronizationMaxResponseSize = utils::FileSize::FromMegabytes(1024);
+			config.MaxHashesPerPoint = 256;
+			config.VotingSetGrouping = Voting_Set_Grouping;
+			return config;
+		}
+
+		cache::AccountStateCacheTypes::Options CreateAccountStateCacheOptions() {
+			return {
+				model::NetworkIdentifier::Testnet,
+				Voting_Set_Grouping,
+				Voting_Set_Grouping,
+				Amount(),
+				Amount(std::numeric_limits<Amount::ValueType>::max()),
+				Amount(2'000'000),
+				MosaicId(1111),
+				Harvesting_Mosaic_Id
+			};
+		}
+
+		void SignMessage(model::FinalizationMessage& message, const crypto::VotingKeyPair& rootKeyPair) {
+			// produce the same two layer signature as BmPrivateKeyTree::sign without persisting a key tree per voter
+			auto bottomKeyPair = GenerateVotingKeyPair();
+			auto keyId = model::StepIdentifierToBmKeyIdentifier(message.StepIdentifier).KeyId;
+			auto keyIdBuffer = RawBuffer(reinterpret_cast<const uint8_t*>(&keyId), sizeof(uint64_t));
+
+			message.Signature.Root.ParentPublicKey = rootKeyPair.publicKey();
+			crypto::Sign(rootKeyPair, { bottomKeyPair.publicKey(), keyIdBuffer }, message.Signature.Root.Signature);
+
+			const auto* pMessageData = reinterpret_cast<const uint8_t*>(&message) + model::FinalizationMessage::Header_Size;
+			message.Signature.Bottom.ParentPublicKey = bottomKeyPair.publicKey();
+			crypto::Sign(
+					bottomKeyPair,
+					{ pMessageData, message.Size - model::FinalizationMessage::Header_Size },
+					message.Signature.Bottom.Signature);
+		}
+
+		std::shared_ptr<model::FinalizationMessage> CreateMessage(
+				const crypto::VotingKeyPair& keyPair,
+				const model::StepIdentifier& stepIdentifier,
+				Height height,
+				const std::vector<Hash256>& hashes) {
+			auto numHashes = static_cast<uint32_t>(hashes.size());
+			uint32_t messageSize = SizeOf32<model::FinalizationMessage>() + numHashes * static_cast<uint32_t>(Hash256::Size);
+
+			std::shared_ptr<model::FinalizationMessage> pMessage = utils::MakeUniqueWithSize<model::FinalizationMessage>(messageSize);
+			pMessage->Size = messageSize;
+			pMessage->FinalizationMessage_Reserved1 = 0;
+			pMessage->Version = model::FinalizationMessage::Current_Version;
+			pMessage->HashesCount = numHashes;
+			pMessage->StepIdentifier = stepIdentifier;
+			pMessage->Height = height;
+			std::copy(hashes.cbegin(), hashes.cend(), pMessage->HashesPtr());
+
+			SignMessage(*pMessage, keyPair);
+			return pMessage;
+		}
+
+		// endregion
+
+		// region FinalizationBenchContext
+
+		struct EpochData {
+			/// Finalization context at the start of the epoch.
+			model::FinalizationContext Context;
+
+			/// Prevotes and precommits sent by all voters in the first round of the epoch.
+			Messages RoundMessages;
+
+			/// Statistics of the block finalized by the round.
+			model::FinalizationStatistics Statistics;
+		};
+
+		/// Voting set with prepared messages spanning multiple epochs.
+		class FinalizationBenchContext {
+		public:
+			explicit FinalizationBenchContext(size_t numVoters)
+					: m_config(CreateConfiguration())
+					, m_cache(cache::CacheConfiguration(), CreateAccountStateCacheOptions()) {
+				bench::FillWithRandomData(m_generationHash);
+
+				m_votingKeyPairs.reserve(numVoters);
+				for (auto i = 0u; i < numVoters; ++i)
+					m_votingKeyPairs.push_back(GenerateVotingKeyPair());
+
+				addVoters();
+
+				for (auto i = 0u; i < Num_Epochs; ++i)
+					m_epochs.push_back(createEpoch(FinalizationEpoch(i + 2)));
+			}
+
+		public:
+			size_t numVoters() const {
+				return m_votingKeyPairs.size();
+			}
+
+			size_t numMessages() const {
+				return Num_Epochs * 2 * numVoters();
+			}
+
+			const std::vector<EpochData>& epochs() const {
+				return m_epochs;
+			}
+
+		public:
+			model::FinalizationContext createFinalizationContext(FinalizationEpoch epoch) const {
+				auto height = model::CalculateVotingSetEndHeight(epoch - FinalizationEpoch(1), Voting_Set_Grouping);
+				auto view = m_cache.createView();
+				return model::FinalizationContext(epoch, height, m_generationHash, m_config, *view);
+			}
+
+			Aggregators createAggregators() const {
+				Aggregators aggregators;
+				for (const auto& epochData : m_epochs)
+					aggregators.push_back(CreateRoundMessageAggregator(epochData.Context));
+
+				return aggregators;
+			}
+
+		private:
+			void addVoters() {
+				auto delta = m_cache.createDelta();
+				for (const auto& keyPair : m_votingKeyPairs) {
+					Address address;
+					bench::FillWithRandomData(address);
+
+					delta->addAccount(address, Height(1));
+					auto& accountState = delta->find(address).get();
+					auto pinnedVotingKey = model::PinnedVotingKey{ keyPair.publicKey(), FinalizationEpoch(1), FinalizationEpoch(100) };
+					accountState.SupplementalPublicKeys.voting().add(pinnedVotingKey);
+					accountState.Balances.credit(Harvesting_Mosaic_Id, Voter_Balance);
+				}
+
+				delta->updateHighValueAccounts(Height(1));
+				m_cache.commit();
+			}
+
+			EpochData createEpoch(FinalizationEpoch epoch) const {
+				auto context = createFinalizationContext(epoch);
+				auto height = context.height();
+				auto precommitHeight = height + Height(Num_Prevote_Hashes - 1);
+
+				std::vector<Hash256> hashes(Num_Prevote_Hashes);
+				for (auto& hash : hashes)
+					bench::FillWithRandomData(hash);
+
+				auto round = model::FinalizationRound{ epoch, FinalizationPoint(1) };
+				auto prevoteStepIdentifier = model::StepIdentifier(round.Epoch, round.Point, model::FinalizationStage::Prevote);
+				auto precommitStepIdentifier = model::StepIdentifier(round.Epoch, round.Point, model::FinalizationStage::Precommit);
+
+				Messages messages;
+				messages.reserve(2 * numVoters());
+				for (const auto& keyPair : m_votingKeyPairs)
+					messages.push_back(CreateMessage(keyPair, prevoteStepIdentifier, height, hashes));
+
+				for (const auto& keyPair : m_votingKeyPairs)
+					messages.push_back(CreateMessage(keyPair, precommitStepIdentifier, precommitHeight, { hashes.back() }));
+
+				return { std::move(context), std::move(messages), { round, precommitHeight, hashes.back() } };
+			}
+
+		private:
+			finalization::FinalizationConfiguration m_config;
+			cache::AccountStateCache m_cache;
+			GenerationHash m_generationHash;
+			std::vector<crypto::VotingKeyPair> m_votingKeyPairs;
+			std::vector<EpochData> m_epochs;
+		};
+
+		const FinalizationBenchContext& GetBenchContext(benchmark::State& state) {
+			SuppressTraceLogging();
+
+			// signing all messages is expensive, so reuse contexts across benchmarks with the same number of voters
+			static std::map<size_t, std::unique_ptr<FinalizationBenchContext>> benchContexts;
+			auto numVoters = static_cast<size_t>(state.range(0));
+			auto iter = benchContexts.find(numVoters);
+			if (benchContexts.cend() == iter)
+				iter = benchContexts.emplace(numVoters, std::make_unique<FinalizationBenchContext>(numVoters)).first;
+
+			return *iter->second;
+		}
+
+		bool IsSuccess(RoundMessageAggregatorAddResult result) {
+			return RoundMessageAggregatorAddResult::Success_Prevote == result
+					|| RoundMessageAggregatorAddResult::Success_Precommit == result;
+		}
+
+		uint64_t CalculateRetainedMessageBytes(const RoundMessageAggregator& aggregator) {
+			uint64_t numBytes = 0;
+			for (const auto& pMessage : aggregator.unknownMessages({}))
+				numBytes += pMessage->Size;
+
+			return numBytes;
+		}
+
+		void SetRoundCounters(benchmark::State& state, const Aggregators& aggregators) {
+			uint64_t numMessageBytes = 0;
+			for (const auto& pAggregator : aggregators)
+				numMessageBytes += CalculateRetainedMessageBytes(*pAggregator);
+
+			state.counters["MessageBytesPerRound"] = static_cast<double>(numMessageBytes / aggregators.size());
+		}
+
+		// endregion
+
+		// region add traits
+
+		struct AddTraits {
+			static size_t AddAll(RoundMessageAggregator& aggregator, const Messages& messages) {
+				auto numFailures = 0u;
+				for (const auto& pMessage : messages) {
+					if (!IsSuccess(aggregator.add(pMessage)))
+						++numFailures;
+				}
+
+				return numFailures;
+			}
+		};
+
+		struct BatchVerifiedAddTraits {
+			static size_t AddAll(RoundMessageAggregator& aggregator, const Messages& messages) {
+				auto numFailures = 0u;
+				auto verifyResults = model::VerifyMessageSignatures(CreateRandomFiller(), messages.data(), messages.size());
+				for (auto i = 0u; i < messages.size(); ++i) {
+					if (!verifyResults[i] || !IsSuccess(aggregator.addWithVerifiedSignature(messages[i])))
+						++numFailures;
+				}
+
+				return numFailures;
+			}
+		};
+
+		struct PreverifiedAddTraits {
+			static size_t AddAll(RoundMessageAggregator& aggregator, const Messages& messages) {
+				auto numFailures = 0u;
+				for (const auto& pMessage : messages) {
+					if (!IsSuccess(aggregator.addWithVerifiedSignature(pMessage)))
+						++numFailures;
+				}
+
+				return numFailures;
+			}
+		};
+
+		Aggregators CreateFilledAggregators(const FinalizationBenchContext& benchContext) {
+			auto aggregators = benchContext.createAggregators();
+			for (auto i = 0u; i < aggregators.size(); ++i)
+				PreverifiedAddTraits::AddAll(*aggregators[i], benchContext.epochs()[i].RoundMessages);
+
+			return aggregators;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkFinalizationContextCreation(benchmark::State& state) {
+			const auto& benchContext = GetBenchContext(state);
+
+			for (auto _ : state) {
+				for (const auto& epochData : benchContext.epochs())
+					benchmark::DoNotOptimize(benchContext.createFinalizationContext(epochData.Context.epoch()));
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Epochs * benchContext.numVoters() * state.iterations()));
+		}
+
+		template<typename TTraits>
+		void BenchmarkRoundMessageAggregation(benchmark::State& state) {
+			const auto& benchContext = GetBenchContext(state);
+
+			size_t numFailures = 0;
+			Aggregators aggregators;
+			for (auto _ : state) {
+				state.PauseTiming();
+				aggregators = benchContext.createAggregators();
+				state.ResumeTiming();
+
+				for (auto i = 0u; i < aggregators.size(); ++i)
+					numFailures += TTraits::AddAll(*aggregators[i], benchContext.epochs()[i].RoundMessages);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(benchContext.numMessages() * state.iterations()));
+			SetRoundCounters(state, aggregators);
+			if (0 != numFailures)
+				CATAPULT_LOG(warning) << numFailures << " messages were not accepted by the aggregator";
+		}
+
+		void BenchmarkRoundStepQueries(benchmark::State& state) {
+			const auto& benchContext = GetBenchContext(state);
+			auto aggregators = CreateFilledAggregators(benchContext);
+
+			auto numFailures = 0u;
+			for (auto _ : state) {
+				for (const auto& pAggregator : aggregators) {
+					const auto& roundContext = pAggregator->roundContext();
+					benchmark::DoNotOptimize(roundContext.tryFindBestPrevote());
+					benchmark::DoNotOptimize(roundContext.tryFindBestPrecommit());
+					if (!roundContext.isCompletable())
+						++numFailures;
+				}
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Epochs * state.iterations()));
+			if (0 != numFailures)
+				CATAPULT_LOG(warning) << numFailures << " rounds were unexpectedly not completable";
+		}
+
+		void BenchmarkProofCreation(benchmark::State& state) {
+			const auto& benchContext = GetBenchContext(state);
+			auto aggregators = CreateFilledAggregators(benchContext);
+
+			std::vector<RoundMessageAggregator::UnknownMessages> roundMessages;
+			for (const auto& pAggregator : aggregators)
+				roundMessages.push_back(pAggregator->unknownMessages({}));
+
+			uint64_t numProofBytes = 0;
+			for (auto _ : state) {
+				numProofBytes = 0;
+				for (auto i = 0u; i < roundMessages.size(); ++i) {
+					auto pProof = model::CreateFinalizationProof(benchContext.epochs()[i].Statistics, roundMessages[i]);
+					numProofBytes += pProof->Size;
+				}
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(benchContext.numMessages() * state.iterations()));
+			state.counters["ProofBytesPerRound"] = static_cast<double>(numProofBytes / Num_Epochs);
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			benchmark.UseRealTime()->Unit(::benchmark::kMillisecond);
+			for (auto numVoters : { 1'000, 2'500, 5'000, 10'000 })
+				benchmark.Arg(numVoters);
+		}
+	}
+}}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) benchmark::RegisterBenchmark(#BENCH_NAME, catapult::chain::BENCH_NAME)
+
+#define CATAPULT_REGISTER_FINALIZATION_BENCHMARK(BENCH_NAME) catapult::chain::AddDefaultArguments(*REGISTER_BENCHMARK(BENCH_NAME))
+
+#define CATAPULT_REGISTER_AGGREGATION_BENCHMARK(TRAITS_NAME) \
+	catapult::chain::AddDefaultArguments(*benchmark::RegisterBenchmark( \
+			"BenchmarkRoundMessageAggregation<" #TRAITS_NAME ">", \
+			catapult::chain::BenchmarkRoundMessageAggregation<catapult::chain::TRAITS_NAME>))
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_FINALIZATION_BENCHMARK(BenchmarkFinalizationContextCreation);
+	CATAPULT_REGISTER_AGGREGATION_BENCHMARK(AddTraits);
+	CATAPULT_REGISTER_AGGREGATION_BENCHMARK(BatchVerifiedAddTraits);
+	CATAPULT_REGISTER_AGGREGATION_BENCHMARK(PreverifiedAddTraits);
+	CATAPULT_REGISTER_FINALIZATION_BENCHMARK(BenchmarkRoundStepQueries);
+	CATAPULT_REGISTER_FINALIZATION_BENCHMARK(BenchmarkProofCreation);
+}
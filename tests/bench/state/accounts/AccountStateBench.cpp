@@ -0,0 +1,233 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/state/AccountState.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+	// track all heap allocations made by this process so that per account heap usage can be reported
+	std::atomic<uint64_t> g_numAllocations(0);
+	std::atomic<uint64_t> g_numAllocatedBytes(0);
+}
+
+void* operator new(size_t size) {
+	++g_numAllocations;
+	g_numAllocatedBytes += size;
+
+	auto* pMemory = std::malloc(size);
+	if (!pMemory)
+		throw std::bad_alloc();
+
+	return pMemory;
+}
+
+void operator delete(void* pMemory) noexcept {
+	std::free(pMemory);
+}
+
+void operator delete(void* pMemory, size_t) noexcept {
+	std::free(pMemory);
+}
+
+namespace catapult { namespace state {
+
+	namespace {
+		constexpr auto Currency_Mosaic_Id = MosaicId(1234);
+		constexpr auto Harvesting_Mosaic_Id = MosaicId(9876);
+
+		// roughly one in twenty accounts is a harvester with supplemental keys and importance information
+		constexpr size_t Harvester_Account_Interval = 20;
+
+		// region AllocationCounter
+
+		class AllocationCounter {
+		public:
+			AllocationCounter()
+					: m_numAllocations(g_numAllocations)
+					, m_numAllocatedBytes(g_numAllocatedBytes)
+			{}
+
+		public:
+			uint64_t numAllocations() const {
+				return g_numAllocations - m_numAllocations;
+			}
+
+			uint64_t numAllocatedBytes() const {
+				return g_numAllocatedBytes - m_numAllocatedBytes;
+			}
+
+		private:
+			uint64_t m_numAllocations;
+			uint64_t m_numAllocatedBytes;
+		};
+
+		// endregion
+
+		// region utils
+
+		template<typename TArray>
+		TArray GenerateRandomArray() {
+			TArray array;
+			bench::FillWithRandomData(array);
+			return array;
+		}
+
+		std::vector<Address> GenerateAddresses(size_t count) {
+			std::vector<Address> addresses(count);
+			bench::FillWithRandomData({ reinterpret_cast<uint8_t*>(addresses.data()), count * Address::Size });
+			return addresses;
+		}
+
+		AccountState CreateAccountState(const Address& address, size_t index) {
+			AccountState accountState(address, Height(1));
+			accountState.Balances.credit(Currency_Mosaic_Id, Amount(1'000'000 + index));
+			if (0 != index % Harvester_Account_Interval)
+				return accountState;
+
+			accountState.PublicKey = GenerateRandomArray<Key>();
+			accountState.PublicKeyHeight = Height(1);
+			accountState.Balances.credit(Harvesting_Mosaic_Id, Amount(10'000'000 + index));
+
+			accountState.SupplementalPublicKeys.linked().set(GenerateRandomArray<Key>());
+			accountState.SupplementalPublicKeys.node().set(GenerateRandomArray<Key>());
+			accountState.SupplementalPublicKeys.vrf().set(GenerateRandomArray<Key>());
+			auto votingKey = GenerateRandomArray<VotingKey>();
+			accountState.SupplementalPublicKeys.voting().add({ votingKey, FinalizationEpoch(1), FinalizationEpoch(360) });
+
+			accountState.ImportanceSnapshots.set(Importance(index), model::ImportanceHeight(720));
+			accountState.ActivityBuckets.update(model::ImportanceHeight(720), [index](auto& bucket) {
+				bucket.TotalFeesPaid = Amount(index);
+				bucket.BeneficiaryCount = 1;
+				bucket.RawScore = index;
+			});
+			return accountState;
+		}
+
+		std::vector<AccountState> CreateAccountStates(const std::vector<Address>& addresses) {
+			std::vector<AccountState> accountStates;
+			accountStates.reserve(addresses.size());
+			for (auto i = 0u; i < addresses.size(); ++i)
+				accountStates.push_back(CreateAccountState(addresses[i], i));
+
+			return accountStates;
+		}
+
+		void SetMemoryCounters(benchmark::State& state, const AllocationCounter& counter, size_t numAccounts) {
+			auto numAccountsPerIteration = static_cast<double>(numAccounts * state.iterations());
+			state.counters["AccountStateBytes"] = static_cast<double>(sizeof(AccountState));
+			state.counters["AllocationsPerAccount"] = static_cast<double>(counter.numAllocations()) / numAccountsPerIteration;
+			state.counters["HeapBytesPerAccount"] = static_cast<double>(counter.numAllocatedBytes()) / numAccountsPerIteration;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkCreateAccountStates(benchmark::State& state) {
+			auto addresses = GenerateAddresses(static_cast<size_t>(state.range(0)));
+
+			AllocationCounter counter;
+			for (auto _ : state) {
+				auto accountStates = CreateAccountStates(addresses);
+				benchmark::DoNotOptimize(accountStates.data());
+
+				// exclude deallocation from the measurement
+				state.PauseTiming();
+				accountStates = std::vector<AccountState>();
+				state.ResumeTiming();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(addresses.size()) * static_cast<int64_t>(state.iterations()));
+			SetMemoryCounters(state, counter, addresses.size());
+		}
+
+		void BenchmarkCopyAccountStates(benchmark::State& state) {
+			// copying corresponds to the first modification of an account in a cache delta
+			auto accountStates = CreateAccountStates(GenerateAddresses(static_cast<size_t>(state.range(0))));
+
+			AllocationCounter counter;
+			for (auto _ : state) {
+				std::vector<AccountState> accountStateCopies;
+				accountStateCopies.reserve(accountStates.size());
+				for (const auto& accountState : accountStates)
+					accountStateCopies.push_back(accountState);
+
+				benchmark::DoNotOptimize(accountStateCopies.data());
+
+				state.PauseTiming();
+				accountStateCopies = std::vector<AccountState>();
+				state.ResumeTiming();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(accountStates.size()) * static_cast<int64_t>(state.iterations()));
+			SetMemoryCounters(state, counter, accountStates.size());
+		}
+
+		void BenchmarkScanAccountStates(benchmark::State& state) {
+			auto accountStates = CreateAccountStates(GenerateAddresses(static_cast<size_t>(state.range(0))));
+
+			for (auto _ : state) {
+				// touch the fields read by importance calculation and high value account tracking
+				Amount totalBalance;
+				Importance totalImportance;
+				size_t numVrfKeys = 0;
+				size_t numVotingKeys = 0;
+				for (const auto& accountState : accountStates) {
+					totalBalance = totalBalance + accountState.Balances.get(Harvesting_Mosaic_Id);
+					totalImportance = totalImportance + accountState.ImportanceSnapshots.current();
+					numVrfKeys += accountState.SupplementalPublicKeys.vrf() ? 1 : 0;
+					numVotingKeys += accountState.SupplementalPublicKeys.voting().size();
+				}
+
+				benchmark::DoNotOptimize(totalBalance);
+				benchmark::DoNotOptimize(totalImportance);
+				benchmark::DoNotOptimize(numVrfKeys);
+				benchmark::DoNotOptimize(numVotingKeys);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(accountStates.size()) * static_cast<int64_t>(state.iterations()));
+			state.counters["AccountStateBytes"] = static_cast<double>(sizeof(AccountState));
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto numAccounts : { 100'000, 1'000'000, 5'000'000 })
+				benchmark.UseRealTime()->Unit(::benchmark::kMillisecond)->Arg(numAccounts);
+		}
+	}
+}}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME)
+
+#define CATAPULT_REGISTER_ACCOUNT_STATE_BENCHMARK(BENCH_NAME) \
+	catapult::state::AddDefaultArguments(*REGISTER_BENCHMARK(catapult::state::BENCH_NAME))
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_ACCOUNT_STATE_BENCHMARK(BenchmarkCreateAccountStates);
+	CATAPULT_REGISTER_ACCOUNT_STATE_BENCHMARK(BenchmarkCopyAccountStates);
+	CATAPULT_REGISTER_ACCOUNT_STATE_BENCHMARK(BenchmarkScanAccountStates);
+}
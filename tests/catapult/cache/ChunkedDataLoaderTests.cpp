@@ -106,6 +106,34 @@ namespace catapult { namespace cache {
 		EXPECT_FALSE(loader.hasNext());
 	}
 
+	TEST(TEST_CLASS, CanLoadStorageFromStreamInMultipleChunks) {
+		// Arrange:
+		auto seed = GenerateRandomEntries(7);
+		auto buffer = CopyEntriesToStreamBuffer(seed);
+		mocks::MockMemoryStream stream(buffer);
+		ChunkedDataLoader<TestEntryLoaderTraits> loader(stream);
+
+		// Act:
+		auto offset = 0u;
+		for (auto count : { 2u, 3u, 2u }) {
+			// Sanity:
+			EXPECT_TRUE(loader.hasNext());
+
+			// Act:
+			auto loadedEntries = loader.nextChunk(count);
+
+			// Assert:
+			auto expectedEntries = std::vector<TestEntry>(seed.cbegin() + offset, seed.cbegin() + offset + count);
+			EXPECT_EQ(count, loadedEntries.size());
+			EXPECT_EQ(expectedEntries, loadedEntries) << "offset " << offset << ", count " << count;
+			offset += count;
+		}
+
+		// Assert:
+		EXPECT_FALSE(loader.hasNext());
+		EXPECT_TRUE(loader.nextChunk(100).empty());
+	}
+
 	TEST(TEST_CLASS, ReadingFromEndOfStreamHasNoEffect) {
 		// Arrange:
 		auto buffer = CopyEntriesToStreamBuffer({});
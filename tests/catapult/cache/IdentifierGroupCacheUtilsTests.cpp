@@ -104,6 +104,42 @@ namespace catapult { namespace cache {
 		});
 	}
 
+	TEST(TEST_CLASS, AddIdentifierWithGroup_AddsIdentifierToRemovedGroup) {
+		// Arrange:
+		RunAddIdentifierWithGroupTest([](auto& groupedDelta) {
+			groupedDelta.remove(Height(3));
+
+			// Act:
+			AddIdentifierWithGroup(groupedDelta, Height(3), 7);
+
+			// Assert: removed identifiers are not restored
+			const auto* pGroup = groupedDelta.find(Height(3)).get();
+			ASSERT_TRUE(!!pGroup);
+			EXPECT_EQ(TestIdentifierGroup::Identifiers({ 7 }), pGroup->identifiers());
+		});
+	}
+
+	TEST(TEST_CLASS, AddIdentifierWithGroup_AddsIdentifierToCommittedGroupWithoutModifyingOriginal) {
+		// Arrange:
+		HeightGroupedBaseSetType groupedSet;
+		auto pGroupedDelta = groupedSet.rebase();
+		pGroupedDelta->insert(AddValues(TestIdentifierGroup(Height(3)), { 1, 4, 9 }));
+		groupedSet.commit();
+
+		// Act:
+		AddIdentifierWithGroup(*pGroupedDelta, Height(3), 7);
+
+		// Assert:
+		EXPECT_EQ(1u, pGroupedDelta->size());
+		const auto* pGroup = pGroupedDelta->find(Height(3)).get();
+		ASSERT_TRUE(!!pGroup);
+		EXPECT_EQ(TestIdentifierGroup::Identifiers({ 1, 4, 7, 9 }), pGroup->identifiers());
+
+		const auto* pOriginalGroup = groupedSet.find(Height(3)).get();
+		ASSERT_TRUE(!!pOriginalGroup);
+		EXPECT_EQ(TestIdentifierGroup::Identifiers({ 1, 4, 9 }), pOriginalGroup->identifiers());
+	}
+
 	// endregion
 
 	// region RunHeightGroupedTest
@@ -1538,6 +1538,29 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(model::AddressSet({ addresses[0], addresses[2] }), delta->highValueAccounts().addresses());
 	}
 
+	TEST(TEST_CLASS, UpdateHighValueAccountsProcessesAccountsModifiedSinceLastUpdate) {
+		// Arrange: set min balance to 1M
+		auto options = Default_Cache_Options;
+		options.MinHarvesterBalance = Amount(1'000'000);
+		AccountStateCache cache(CacheConfiguration(), options);
+
+		// - prepare delta with 2/3 accounts with sufficient balance
+		auto delta = cache.createDelta();
+		auto addresses = AddAccountsWithBalances(*delta, { Amount(1'100'000), Amount(900'000), Amount(1'000'000) });
+		delta->updateHighValueAccounts(Height(1));
+
+		// - modify two accounts and add one account after the first update
+		delta->find(addresses[1]).get().Balances.credit(Harvesting_Mosaic_Id, Amount(100'000));
+		delta->find(addresses[2]).get().Balances.debit(Harvesting_Mosaic_Id, Amount(1));
+		auto addedAddresses = AddAccountsWithBalances(*delta, { Amount(1'200'000) });
+
+		// Act:
+		delta->updateHighValueAccounts(Height(2));
+
+		// Assert:
+		EXPECT_EQ(model::AddressSet({ addresses[0], addresses[1], addedAddresses[0] }), delta->highValueAccounts().addresses());
+	}
+
 	// endregion
 
 	// region processHighValueRemovedAccounts
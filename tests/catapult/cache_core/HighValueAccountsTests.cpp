@@ -1264,6 +1264,170 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region updater - incremental update
+
+	TEST(TEST_CLASS, Updater_IncrementalUpdateOnlyProcessesModifiedAccounts) {
+		// Arrange: add seven [5 match {0, 2, 4, 5, 6}]
+		test::DeltaElementsTestUtils::Wrapper<MemorySetType> deltas;
+		auto addedAddresses = AddAccountsWithBalances(deltas.Added, {
+			Amount(2'100'000), Amount(900'000), Amount(2'000'000), Amount(800'000), Amount(2'200'000), Amount(2'400'000), Amount(2'300'000)
+		});
+
+		auto accounts = CreateAccounts({});
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		updater.setHeight(Height(3));
+		updater.update(deltas.deltas());
+
+		// - modify four but only mark two as modified
+		Credit(deltas.Copied.insert(*deltas.Added.find(addedAddresses[1])).first->second, Amount(1'200'000));
+		Debit(deltas.Copied.insert(*deltas.Added.find(addedAddresses[2])).first->second, Amount(1));
+		Credit(deltas.Copied.insert(*deltas.Added.find(addedAddresses[3])).first->second, Amount(1'250'000));
+		Debit(deltas.Copied.insert(*deltas.Added.find(addedAddresses[6])).first->second, Amount(300'001));
+
+		// Act:
+		updater.setHeight(Height(4));
+		updater.update(deltas.deltas(), Pick(addedAddresses, { 1, 2 }));
+
+		// Assert: changes to unmarked accounts are ignored
+		auto expectedAccountHistories = test::GenerateAccountHistories({
+			{ addedAddresses[0], { { Height(3), Amount(2'100'000) } } },
+			{ addedAddresses[1], { { Height(4), Amount(2'100'000) } } },
+			{ addedAddresses[2], { { Height(3), Amount(2'000'000) }, { Height(4), Amount() } } },
+			{ addedAddresses[4], { { Height(3), Amount(2'200'000) } } },
+			{ addedAddresses[5], { { Height(3), Amount(2'400'000) } } },
+			{ addedAddresses[6], { { Height(3), Amount(2'300'000) } } }
+		});
+
+		test::AssertEqualBalanceHistoryOnly(expectedAccountHistories, updater.accountHistories());
+		EXPECT_EQ(Pick(addedAddresses, { 0, 1, 2, 4, 5, 6 }), updater.addresses());
+		EXPECT_TRUE(updater.removedAddresses().empty());
+	}
+
+	TEST(TEST_CLASS, Updater_IncrementalUpdateIsEquivalentToFullUpdateWhenAllModifiedAccountsAreMarked) {
+		// Arrange: add seven
+		test::DeltaElementsTestUtils::Wrapper<MemorySetType> deltas;
+		auto addedAddresses = AddAccountsWithBalances(deltas.Added, {
+			Amount(2'100'000), Amount(900'000), Amount(2'000'000), Amount(800'000), Amount(2'200'000), Amount(2'400'000), Amount(2'300'000)
+		});
+
+		auto accounts = CreateAccounts({});
+		HighValueAccountsUpdater fullUpdater(CreateOptions(), accounts);
+		HighValueAccountsUpdater incrementalUpdater(CreateOptions(), accounts);
+
+		auto update = [&deltas, &fullUpdater, &incrementalUpdater](auto height, const auto& modifiedAddresses) {
+			fullUpdater.setHeight(height);
+			fullUpdater.update(deltas.deltas());
+
+			incrementalUpdater.setHeight(height);
+			incrementalUpdater.update(deltas.deltas(), modifiedAddresses);
+		};
+
+		// Act:
+		update(Height(3), Pick(addedAddresses, { 0, 1, 2, 3, 4, 5, 6 }));
+
+		// - modify four
+		Credit(deltas.Copied.insert(*deltas.Added.find(addedAddresses[1])).first->second, Amount(1'200'000));
+		Debit(deltas.Copied.insert(*deltas.Added.find(addedAddresses[2])).first->second, Amount(1));
+		Credit(deltas.Copied.insert(*deltas.Added.find(addedAddresses[3])).first->second, Amount(1'250'000));
+		Debit(deltas.Copied.insert(*deltas.Added.find(addedAddresses[6])).first->second, Amount(300'001));
+		update(Height(4), Pick(addedAddresses, { 1, 2, 3, 6 }));
+
+		// - delete two
+		deltas.Removed.insert(*deltas.Added.find(addedAddresses[1]));
+		deltas.Removed.insert(*deltas.Added.find(addedAddresses[4]));
+		deltas.Copied.erase(addedAddresses[1]);
+		deltas.Added.erase(addedAddresses[1]);
+		deltas.Added.erase(addedAddresses[4]);
+		update(Height(5), Pick(addedAddresses, { 1, 4 }));
+
+		// Assert:
+		test::AssertEqualBalanceHistoryOnly(fullUpdater.accountHistories(), incrementalUpdater.accountHistories());
+		EXPECT_EQ(fullUpdater.addresses(), incrementalUpdater.addresses());
+		EXPECT_EQ(fullUpdater.removedAddresses(), incrementalUpdater.removedAddresses());
+
+		// Sanity:
+		EXPECT_EQ(Pick(addedAddresses, { 0, 2, 3, 5, 6 }), incrementalUpdater.addresses());
+		EXPECT_EQ(7u, incrementalUpdater.accountHistories().size());
+	}
+
+	TEST(TEST_CLASS, Updater_IncrementalUpdateReprocessesAllAccountsAfterRollback) {
+		// Arrange: add seven [5 match {0, 2, 4, 5, 6}]
+		test::DeltaElementsTestUtils::Wrapper<MemorySetType> deltas;
+		auto addedAddresses = AddAccountsWithBalances(deltas.Added, {
+			Amount(2'100'000), Amount(900'000), Amount(2'000'000), Amount(800'000), Amount(2'200'000), Amount(2'400'000), Amount(2'300'000)
+		});
+
+		auto accounts = CreateAccounts({});
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		updater.setHeight(Height(3));
+		updater.update(deltas.deltas(), Pick(addedAddresses, { 0, 1, 2, 3, 4, 5, 6 }));
+
+		// - modify two
+		Credit(deltas.Copied.insert(*deltas.Added.find(addedAddresses[3])).first->second, Amount(1'250'000));
+		Debit(deltas.Copied.insert(*deltas.Added.find(addedAddresses[6])).first->second, Amount(300'001));
+
+		updater.setHeight(Height(9));
+		updater.update(deltas.deltas(), Pick(addedAddresses, { 3, 6 }));
+
+		// Act: roll back without marking any accounts as modified
+		updater.setHeight(Height(6));
+		updater.update(deltas.deltas(), model::AddressSet());
+
+		// Assert: changes at height 9 are reapplied at height 6
+		auto expectedAccountHistories = test::GenerateAccountHistories({
+			{ addedAddresses[0], { { Height(3), Amount(2'100'000) } } },
+			{ addedAddresses[2], { { Height(3), Amount(2'000'000) } } },
+			{ addedAddresses[3], { { Height(6), Amount(2'050'000) } } },
+			{ addedAddresses[4], { { Height(3), Amount(2'200'000) } } },
+			{ addedAddresses[5], { { Height(3), Amount(2'400'000) } } },
+			{ addedAddresses[6], { { Height(3), Amount(2'300'000) }, { Height(6), Amount() } } }
+		});
+
+		test::AssertEqualBalanceHistoryOnly(expectedAccountHistories, updater.accountHistories());
+	}
+
+	TEST(TEST_CLASS, Updater_ContainersAreSharedWithOriginalAccountsUntilModified) {
+		// Arrange:
+		test::DeltaElementsTestUtils::Wrapper<MemorySetType> deltas;
+		auto addedAddresses = AddAccountsWithBalances(deltas.Added, { Amount(2'100'000), Amount(900'000) });
+
+		auto seedAccounts = CreateAccounts({});
+		HighValueAccountsUpdater seedUpdater(CreateOptions(), seedAccounts);
+		seedUpdater.setHeight(Height(3));
+		seedUpdater.update(deltas.deltas());
+
+		auto originalAccounts = seedUpdater.detachAccounts();
+		HighValueAccountsUpdater updater(CreateOptions(), originalAccounts);
+
+		// Act: process unchanged accounts
+		updater.setHeight(Height(4));
+		updater.update(deltas.deltas(), Pick(addedAddresses, { 0, 1 }));
+
+		// Assert: nothing was copied
+		EXPECT_EQ(&originalAccounts.addresses(), &updater.addresses());
+		EXPECT_EQ(&originalAccounts.removedAddresses(), &updater.removedAddresses());
+		EXPECT_EQ(&originalAccounts.accountHistories(), &updater.accountHistories());
+
+		// Act: process a changed account
+		Credit(deltas.Added.find(addedAddresses[1])->second, Amount(1'200'000));
+		updater.setHeight(Height(5));
+		updater.update(deltas.deltas(), Pick(addedAddresses, { 1 }));
+
+		// Assert: modified containers were copied and originals are unchanged
+		EXPECT_NE(&originalAccounts.addresses(), &updater.addresses());
+		EXPECT_EQ(&originalAccounts.removedAddresses(), &updater.removedAddresses());
+		EXPECT_NE(&originalAccounts.accountHistories(), &updater.accountHistories());
+
+		EXPECT_EQ(model::AddressSet({ addedAddresses[0] }), originalAccounts.addresses());
+		EXPECT_EQ(1u, originalAccounts.accountHistories().size());
+		EXPECT_EQ(Pick(addedAddresses, { 0, 1 }), updater.addresses());
+		EXPECT_EQ(2u, updater.accountHistories().size());
+	}
+
+	// endregion
+
 	// region updater - detachAccounts
 
 	TEST(TEST_CLASS, Updater_DetachAccountsReturnsExpectedHighValueAccounts) {
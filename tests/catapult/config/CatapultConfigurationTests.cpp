@@ -115,6 +115,7 @@ namespace catapult { namespace config {
 			EXPECT_TRUE(config.EnableAutoSyncCleanup);
 
 			EXPECT_EQ(100u, config.FileDatabaseBatchSize);
+			EXPECT_EQ(10u, config.MaxStateDeltaSnapshots);
 
 			EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
@@ -45,6 +45,7 @@ namespace catapult { namespace config {
 							{ "enableAutoSyncCleanup", "true" },
 
 							{ "fileDatabaseBatchSize", "888" },
+							{ "maxStateDeltaSnapshots", "12" },
 
 							{ "enableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
@@ -167,6 +168,7 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.EnableAutoSyncCleanup);
 
 				EXPECT_EQ(0u, config.FileDatabaseBatchSize);
+				EXPECT_EQ(0u, config.MaxStateDeltaSnapshots);
 
 				EXPECT_FALSE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
@@ -262,6 +264,7 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.EnableAutoSyncCleanup);
 
 				EXPECT_EQ(888u, config.FileDatabaseBatchSize);
+				EXPECT_EQ(12u, config.MaxStateDeltaSnapshots);
 
 				EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
@@ -116,11 +116,10 @@ namespace catapult { namespace crypto {
 		}
 
 		template<typename TTraits, typename TMutator>
-		void AssertSignedPayloadsCannotBeVerifiedAsBatches(TMutator mutator) {
+		void AssertSignedPayloadsCannotBeVerifiedAsBatches(size_t count, std::unordered_set<size_t>&& failedIndexes, TMutator mutator) {
 			// Arrange:
 			DataHolder dataHolder;
-			auto signatureInputs = CreateSignatureInputs(Default_Signature_Count, dataHolder);
-			std::unordered_set<size_t> failedIndexes{ 1, 17, 58 };
+			auto signatureInputs = CreateSignatureInputs(count, dataHolder);
 			for (auto index : failedIndexes)
 				mutator(signatureInputs, index);
 
@@ -131,6 +130,11 @@ namespace catapult { namespace crypto {
 			TTraits::AssertVerifyResult(result, false, failedIndexes);
 		}
 
+		template<typename TTraits, typename TMutator>
+		void AssertSignedPayloadsCannotBeVerifiedAsBatches(TMutator mutator) {
+			AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(Default_Signature_Count, { 1, 17, 58 }, mutator);
+		}
+
 		RandomFiller CreateRandomFiller() {
 			return [](auto* pOut, auto count) {
 				// can use low entropy source for tests
@@ -195,6 +199,19 @@ namespace catapult { namespace crypto {
 		AssertSignedPayloadsCanBeVerifiedAsBatches<TTraits>(100); // 2 batches
 	}
 
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_FailuresInLaterBatches) {
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(Default_Signature_Count, { 70, 99 }, [](auto& signatureInputs, auto index) {
+			const_cast<Signature&>(signatureInputs[index].Signature)[5] ^= 0xFF;
+		});
+	}
+
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_FailureInUnbatchedRemainder) {
+		// last signature is not batch verified
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(65, { 64 }, [](auto& signatureInputs, auto index) {
+			const_cast<Signature&>(signatureInputs[index].Signature)[5] ^= 0xFF;
+		});
+	}
+
 	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_DifferentKey) {
 		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>([](auto& signatureInputs, auto index) {
 			const_cast<Key&>(signatureInputs[index].PublicKey) = Valid_Public_Key;
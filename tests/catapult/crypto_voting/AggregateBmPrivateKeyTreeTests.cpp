@@ -50,22 +50,26 @@ namespace catapult { namespace crypto {
 			TestContext() : TestContext({ Default_Options })
 			{}
 
-			explicit TestContext(const std::vector<BmOptions>& options)
+			explicit TestContext(const std::vector<BmOptions>& options) : TestContext(options, 0)
+			{}
+
+			TestContext(const std::vector<BmOptions>& options, size_t maxPrefetchedTrees)
 					: m_nextStorageIndex(0)
+					, m_publicKeys(options.size())
 					, m_storages(options.size())
-					, m_tree([this, options]() {
+					, m_pTree(std::make_unique<AggregateBmPrivateKeyTree>([this, options]() {
 						if (m_nextStorageIndex >= options.size())
 							return std::unique_ptr<BmPrivateKeyTree>();
 
 						auto keyPair = GenerateKeyPair();
-						m_publicKeys.push_back(keyPair.publicKey());
+						m_publicKeys[m_nextStorageIndex] = keyPair.publicKey();
 						auto tree = BmPrivateKeyTree::Create(
 								std::move(keyPair),
 								m_storages[m_nextStorageIndex],
 								options[m_nextStorageIndex]);
 						++m_nextStorageIndex;
 						return std::make_unique<BmPrivateKeyTree>(std::move(tree));
-					})
+					}, maxPrefetchedTrees))
 			{}
 
 		public:
@@ -78,14 +82,23 @@ namespace catapult { namespace crypto {
 			}
 
 			auto& tree() {
-				return m_tree;
+				return *m_pTree;
+			}
+
+			size_t numFactoryCalls() const {
+				return m_nextStorageIndex;
+			}
+
+		public:
+			void destroyTree() {
+				m_pTree.reset();
 			}
 
 		private:
-			size_t m_nextStorageIndex;
+			std::atomic<size_t> m_nextStorageIndex;
 			std::vector<VotingKey> m_publicKeys;
 			std::vector<mocks::MockSeekableMemoryStream> m_storages;
-			AggregateBmPrivateKeyTree m_tree;
+			std::unique_ptr<AggregateBmPrivateKeyTree> m_pTree;
 		};
 
 		// endregion
@@ -347,5 +360,121 @@ namespace catapult { namespace crypto {
 		});
 	}
 
+	// endregion
+	// region prefetch
+
+	TEST(TEST_CLASS, PrefetchedTreesAreLoadedInBackground) {
+		// Arrange:
+		TestContext context({ { { 12 }, { 18 } }, { { 19 }, { 30 } }, { { 45 }, { 60 } } }, 2);
+
+		// Act: wait for the trees following the active tree to be loaded
+		WAIT_FOR_VALUE_EXPR(2u, context.tree().numPrefetchedTrees());
+
+		// Assert:
+		EXPECT_EQ(3u, context.numFactoryCalls());
+		EXPECT_EQ(context.publicKey(0), context.tree().rootPublicKey());
+		test::AssertOptions({ { 12 }, { 18 } }, context.tree().options());
+	}
+
+	TEST(TEST_CLASS, AtMostMaxPrefetchedTreesAreLoaded) {
+		// Arrange:
+		TestContext context({ { { 12 }, { 18 } }, { { 19 }, { 30 } }, { { 45 }, { 60 } } }, 1);
+
+		// Act: wait for the next tree to be loaded
+		WAIT_FOR_ONE_EXPR(context.tree().numPrefetchedTrees());
+		test::Pause();
+
+		// Assert: only the active tree and a single prefetched tree are loaded
+		EXPECT_EQ(1u, context.tree().numPrefetchedTrees());
+		EXPECT_EQ(2u, context.numFactoryCalls());
+	}
+
+	TEST(TEST_CLASS, NoTreesArePrefetchedWhenPrefetchingIsDisabled) {
+		// Arrange:
+		TestContext context({ { { 12 }, { 18 } }, { { 19 }, { 30 } } });
+
+		// Assert:
+		EXPECT_EQ(0u, context.tree().numPrefetchedTrees());
+		EXPECT_EQ(1u, context.numFactoryCalls());
+	}
+
+	TEST(TEST_CLASS, CanSignWithAnyTreeReturnedByFactoryWhenPrefetching) {
+		// Arrange:
+		TestContext context({ { { 12 }, { 18 } }, { { 19 }, { 30 } }, { { 45 }, { 60 } } }, 1);
+
+		// Act + Assert:
+		test::AssertCanSign(context.tree(), { 16 }); // tree 1
+		test::AssertCanSign(context.tree(), { 19 }); // tree 2
+		test::AssertCanSign(context.tree(), { 30 });
+		test::AssertCannotSign(context.tree(), { 35 }); // gap
+		test::AssertCanSign(context.tree(), { 55 }); // tree 3
+		test::AssertCannotSign(context.tree(), { 61 }); // after last
+	}
+
+	TEST(TEST_CLASS, RetiredTreesAreWipedWhenPrefetching) {
+		// Arrange:
+		TestContext context({ { { 12 }, { 18 } }, { { 19 }, { 30 } }, { { 45 }, { 60 } } }, 1);
+
+		// Act: advance to the second tree and wait for all background work to complete
+		context.tree().sign({ 16 }, test::GenerateRandomArray<10>());
+		context.tree().sign({ 23 }, test::GenerateRandomArray<10>());
+		context.destroyTree();
+
+		// Assert: everything is cleared in first tree
+		ASSERT_EQ(test::BmTreeSizes::CalculateFullLevelOneSize(7), context.storage(0).buffer().size());
+		test::AssertZeroedKeys(context.storage(0).buffer(), L1_Payload_Start, 7, { 6, 5, 4, 3, 2, 1, 0 }, "L1[0]");
+
+		// - (19, 22) keys are cleared in second tree
+		ASSERT_EQ(test::BmTreeSizes::CalculateFullLevelOneSize(12), context.storage(1).buffer().size());
+		test::AssertZeroedKeys(context.storage(1).buffer(), L1_Payload_Start, 12, { 11, 10, 9, 8 }, "L1[1]");
+	}
+
+	TEST(TEST_CLASS, TreeUnavailableWhenPrefetchedIsLoadedWhenNeeded) {
+		// Arrange: second tree is unavailable when it is first requested and no trees follow it
+		std::atomic<size_t> numFactoryCalls(0);
+		std::vector<mocks::MockSeekableMemoryStream> storages(2);
+		auto tree = AggregateBmPrivateKeyTree([&numFactoryCalls, &storages]() {
+			auto callIndex = numFactoryCalls++;
+			if (1 == callIndex || 2 < callIndex)
+				return std::unique_ptr<BmPrivateKeyTree>();
+
+			auto storageIndex = 0 == callIndex ? 0u : 1u;
+			auto bmOptions = 0 == callIndex ? BmOptions{ { 12 }, { 18 } } : BmOptions{ { 19 }, { 30 } };
+			auto bmTree = BmPrivateKeyTree::Create(GenerateKeyPair(), storages[storageIndex], bmOptions);
+			return std::make_unique<BmPrivateKeyTree>(std::move(bmTree));
+		}, 1);
+
+		WAIT_FOR_VALUE(2u, numFactoryCalls);
+
+		// Sanity:
+		EXPECT_EQ(0u, tree.numPrefetchedTrees());
+
+		// Act + Assert: factory is retried when the next tree is needed
+		test::AssertCanSign(tree, { 19 });
+		EXPECT_LE(3u, numFactoryCalls);
+		test::AssertOptions({ { 19 }, { 30 } }, tree.options());
+	}
+
+	TEST(TEST_CLASS, PrefetchFactoryExceptionIsRethrownWhenTreeIsNeeded) {
+		// Arrange:
+		std::atomic<size_t> numFactoryCalls(0);
+		mocks::MockSeekableMemoryStream storage;
+		auto tree = AggregateBmPrivateKeyTree([&numFactoryCalls, &storage]() {
+			if (0 != numFactoryCalls++)
+				CATAPULT_THROW_RUNTIME_ERROR("factory failure");
+
+			auto bmTree = BmPrivateKeyTree::Create(GenerateKeyPair(), storage, BmOptions{ { 12 }, { 18 } });
+			return std::make_unique<BmPrivateKeyTree>(std::move(bmTree));
+		}, 1);
+
+		WAIT_FOR_VALUE(2u, numFactoryCalls);
+
+		// Sanity:
+		test::AssertCanSign(tree, { 16 });
+
+		// Act + Assert:
+		EXPECT_THROW(tree.canSign({ 19 }), catapult_runtime_error);
+	}
+
 	// endregion
 }}
@@ -25,6 +25,7 @@
 #include "tests/test/core/mocks/MockMemoryStream.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/TestHarness.h"
+#include <unordered_set>
 
 namespace catapult { namespace crypto {
 
@@ -117,6 +118,27 @@ namespace catapult { namespace crypto {
 		test::AssertOptions(Default_Options, tree.options());
 	}
 
+	TEST(TEST_CLASS, CanLoadTreeFromOwnedStream) {
+		// Arrange:
+		auto rootKeyPair = GenerateKeyPair();
+		auto expectedPublicKey = rootKeyPair.publicKey();
+		auto pStorage = std::make_unique<mocks::MockSeekableMemoryStream>();
+		{
+			auto originalTree = BmPrivateKeyTree::Create(std::move(rootKeyPair), *pStorage, Default_Options);
+			pStorage->seek(0);
+		}
+
+		// Act:
+		auto tree = BmPrivateKeyTree::FromStream(std::move(pStorage));
+
+		// Assert:
+		EXPECT_EQ(expectedPublicKey, tree.rootPublicKey());
+		test::AssertOptions(Default_Options, tree.options());
+
+		// - owned stream is usable after load
+		test::AssertCanSign(tree, { 75 });
+	}
+
 	// endregion
 
 	// region canSign / sign - success
@@ -417,5 +439,100 @@ namespace catapult { namespace crypto {
 		}
 	}
 
+	// endregion
+	// region VerifyMulti
+
+	namespace {
+		struct SignedMessages {
+			std::vector<std::array<uint8_t, 10>> Buffers;
+			std::vector<BmTreeSignature> Signatures;
+			std::vector<BmKeyIdentifier> KeyIdentifiers;
+
+			std::vector<BmTreeSignatureInput> toSignatureInputs() const {
+				std::vector<BmTreeSignatureInput> signatureInputs;
+				for (auto i = 0u; i < Signatures.size(); ++i)
+					signatureInputs.push_back({ Signatures[i], KeyIdentifiers[i], Buffers[i] });
+
+				return signatureInputs;
+			}
+		};
+
+		SignedMessages SignMessages(BmPrivateKeyTree& tree, size_t count) {
+			SignedMessages messages;
+			for (auto i = 0u; i < count; ++i) {
+				// keys must be used in nondecreasing order
+				auto keyIdentifier = BmKeyIdentifier{ Start_Key.KeyId + i * Num_Keys / count };
+				messages.Buffers.push_back(test::GenerateRandomArray<10>());
+				messages.Signatures.push_back(tree.sign(keyIdentifier, messages.Buffers.back()));
+				messages.KeyIdentifiers.push_back(keyIdentifier);
+			}
+
+			return messages;
+		}
+
+		RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				// can use low entropy source for tests
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+		}
+
+		template<typename TMutator>
+		void AssertVerifyMulti(size_t count, const std::unordered_set<size_t>& failedIndexes, TMutator mutator) {
+			// Arrange:
+			TestContext context;
+			auto messages = SignMessages(context.tree(), count);
+			for (auto index : failedIndexes)
+				mutator(messages, index);
+
+			// Act:
+			auto signatureInputs = messages.toSignatureInputs();
+			auto results = VerifyMulti(CreateRandomFiller(), signatureInputs.data(), signatureInputs.size());
+
+			// Assert:
+			ASSERT_EQ(count, results.size());
+			for (auto i = 0u; i < count; ++i) {
+				auto isFailedIndex = failedIndexes.cend() != failedIndexes.find(i);
+				EXPECT_EQ(!isFailedIndex, results[i]) << "at index " << i;
+
+				// Sanity: batch result matches single verification result
+				EXPECT_EQ(Verify(messages.Signatures[i], messages.KeyIdentifiers[i], messages.Buffers[i]), results[i]) << "at index " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenNoSignaturesArePresent) {
+		AssertVerifyMulti(0, {}, [](const auto&, auto) {});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenAllSignaturesAreValid) {
+		AssertVerifyMulti(1, {}, [](const auto&, auto) {});
+		AssertVerifyMulti(50, {}, [](const auto&, auto) {});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiDetectsInvalidBuffers) {
+		AssertVerifyMulti(50, { 3, 17, 40 }, [](auto& messages, auto index) {
+			messages.Buffers[index][4] ^= 0xFF;
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiDetectsInvalidKeyIdentifiers) {
+		AssertVerifyMulti(50, { 3, 17, 40 }, [](auto& messages, auto index) {
+			++messages.KeyIdentifiers[index].KeyId;
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiDetectsInvalidRootSignatures) {
+		AssertVerifyMulti(50, { 3, 17, 40 }, [](auto& messages, auto index) {
+			messages.Signatures[index].Root.Signature[5] ^= 0xFF;
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiDetectsInvalidBottomSignatures) {
+		AssertVerifyMulti(50, { 3, 17, 40 }, [](auto& messages, auto index) {
+			messages.Signatures[index].Bottom.Signature[5] ^= 0xFF;
+		});
+	}
+
 	// endregion
 }}
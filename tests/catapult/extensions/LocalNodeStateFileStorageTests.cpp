@@ -41,6 +41,7 @@
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/test/plugins/PluginManagerFactory.h"
 #include "tests/TestHarness.h"
+#include <iomanip>
 
 namespace catapult { namespace extensions {
 
@@ -385,6 +386,150 @@ namespace catapult { namespace extensions {
 
 	// endregion
 
+	// region LoadStateFromDirectory / LocalNodeStateSerializer (differential)
+
+	namespace {
+		void AddBlockStatisticAndSaveChanges(
+				const config::CatapultDirectory& directory,
+				cache::CatapultCache& cache,
+				const model::ChainScore& score,
+				Height parentHeight,
+				Height height) {
+			auto changesStorages = const_cast<const cache::CatapultCache&>(cache).changesStorages();
+			auto delta = cache.createDelta();
+			auto seed = Block_Cache_Size + height.unwrap();
+			auto statistic = state::BlockStatistic(Height(seed), Timestamp(2 * seed), Difficulty(3 * seed), BlockFeeMultiplier());
+			delta.sub<cache::BlockStatisticCache>().insert(statistic);
+			delta.dependentState().NumTotalTransactions = height.unwrap();
+
+			LocalNodeStateSerializer serializer(directory);
+			serializer.saveChanges(delta, changesStorages, score, parentHeight, height);
+			cache.commit(height);
+		}
+
+		void PrepareAndSaveDifferentialState(
+				const config::CatapultDirectory& directory,
+				const config::CatapultDirectory& tempDirectory,
+				cache::CatapultCache& cache,
+				const std::vector<Height>& heights = { Height(54322), Height(54323) }) {
+			// Arrange: save base state (at height 54321) followed by differential state snapshots
+			PrepareAndSaveCompleteState(directory, cache);
+
+			auto score = CreateDeterministicSupplementalData().ChainScore;
+			auto parentHeight = Height(54321);
+			for (auto height : heights) {
+				score += model::ChainScore(1);
+				AddBlockStatisticAndSaveChanges(tempDirectory, cache, score, parentHeight, height);
+				parentHeight = height;
+
+				LocalNodeStateSerializer serializer(tempDirectory);
+				serializer.moveTo(directory);
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CountStateDeltaSnapshotsReturnsZeroWhenNoDifferentialStateIsSaved) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto stateDirectory = config::CatapultDirectory(tempDir.name() + "/zstate");
+		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		PrepareAndSaveCompleteState(stateDirectory, cache);
+
+		// Act + Assert:
+		EXPECT_EQ(0u, CountStateDeltaSnapshots(stateDirectory));
+	}
+
+	TEST(TEST_CLASS, MoveToMergesDifferentialStateIntoDestination) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto stateDirectory = config::CatapultDirectory(tempDir.name() + "/zstate");
+		auto tempStateDirectory = config::CatapultDirectory(tempDir.name() + "/zstate.tmp");
+		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+
+		// Act:
+		PrepareAndSaveDifferentialState(stateDirectory, tempStateDirectory, cache);
+
+		// Assert: base state is preserved and both snapshots are merged
+		EXPECT_FALSE(std::filesystem::exists(tempStateDirectory.path()));
+		EXPECT_EQ(2u, CountStateDeltaSnapshots(stateDirectory));
+
+		EXPECT_EQ(4u, test::CountFilesAndDirectories(stateDirectory.path()));
+		for (const auto* supplementalFilename : { "supplemental.dat", "AccountStateCache.dat", "BlockStatisticCache.dat", "deltas" })
+			EXPECT_TRUE(std::filesystem::exists(stateDirectory.file(supplementalFilename))) << supplementalFilename;
+	}
+
+	TEST(TEST_CLASS, CanSaveAndLoadDifferentialState) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto stateDirectory = config::CatapultDirectory(tempDir.name() + "/zstate");
+		auto tempStateDirectory = config::CatapultDirectory(tempDir.name() + "/zstate.tmp");
+		auto blockChainConfig = model::BlockChainConfiguration::Uninitialized();
+		auto originalCache = test::CoreSystemCacheFactory::Create(blockChainConfig);
+		PrepareAndSaveDifferentialState(stateDirectory, tempStateDirectory, originalCache);
+
+		// Act: load the state
+		test::LocalNodeTestState loadedState(
+				blockChainConfig,
+				stateDirectory.str(),
+				test::CoreSystemCacheFactory::Create(blockChainConfig));
+		auto pluginManager = test::CreatePluginManager();
+		auto heights = LoadStateFromDirectory(stateDirectory, loadedState.ref(), pluginManager);
+
+		// Assert: supplemental data is loaded from most recent snapshot
+		EXPECT_EQ(Height(54323), heights.Cache);
+		EXPECT_EQ(model::ChainScore(0x1234567890ABCDEF, 0xFEDCBA0987654323), loadedState.ref().Score.get());
+
+		auto expectedView = originalCache.createView();
+		auto actualView = loadedState.ref().Cache.createView();
+		EXPECT_EQ(Height(54323), actualView.height());
+		EXPECT_EQ(54323u, actualView.dependentState().NumTotalTransactions);
+
+		// - base state and all changes are loaded
+		EXPECT_EQ(Block_Cache_Size + 2, actualView.sub<cache::BlockStatisticCache>().size());
+		EXPECT_EQ(expectedView.sub<cache::AccountStateCache>().size(), actualView.sub<cache::AccountStateCache>().size());
+		EXPECT_EQ(expectedView.sub<cache::BlockStatisticCache>().size(), actualView.sub<cache::BlockStatisticCache>().size());
+		EXPECT_TRUE(actualView.sub<cache::BlockStatisticCache>().contains(state::BlockStatistic(Height(Block_Cache_Size + 54323))));
+	}
+
+	namespace {
+		void AssertCannotLoadNonContiguousDifferentialState(const std::vector<Height>& heights, Height missingHeight) {
+			// Arrange:
+			test::TempDirectoryGuard tempDir;
+			auto stateDirectory = config::CatapultDirectory(tempDir.name() + "/zstate");
+			auto tempStateDirectory = config::CatapultDirectory(tempDir.name() + "/zstate.tmp");
+			auto blockChainConfig = model::BlockChainConfiguration::Uninitialized();
+			auto originalCache = test::CoreSystemCacheFactory::Create(blockChainConfig);
+			PrepareAndSaveDifferentialState(stateDirectory, tempStateDirectory, originalCache, heights);
+
+			// - remove a snapshot in order to create a gap
+			std::ostringstream snapshotName;
+			snapshotName << std::setfill('0') << std::setw(20) << missingHeight.unwrap();
+			std::filesystem::remove_all(stateDirectory.path() / "deltas" / snapshotName.str());
+
+			// Sanity:
+			EXPECT_EQ(heights.size() - 1, CountStateDeltaSnapshots(stateDirectory));
+
+			test::LocalNodeTestState loadedState(
+					blockChainConfig,
+					stateDirectory.str(),
+					test::CoreSystemCacheFactory::Create(blockChainConfig));
+			auto pluginManager = test::CreatePluginManager();
+
+			// Act + Assert:
+			EXPECT_THROW(LoadStateFromDirectory(stateDirectory, loadedState.ref(), pluginManager), catapult_runtime_error);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotLoadDifferentialStateWithMissingFirstSnapshot) {
+		AssertCannotLoadNonContiguousDifferentialState({ Height(54322), Height(54323) }, Height(54322));
+	}
+
+	TEST(TEST_CLASS, CannotLoadDifferentialStateWithMissingIntermediateSnapshot) {
+		AssertCannotLoadNonContiguousDifferentialState({ Height(54322), Height(54323), Height(54324) }, Height(54323));
+	}
+
+	// endregion
+
 	// region LocalNodeStateSerializer::moveTo
 
 	namespace {
@@ -500,6 +645,41 @@ namespace catapult { namespace extensions {
 		EXPECT_EQ(consumers::CommitOperationStep::All_Updated, ReadCommitStep(dataDirectory));
 	}
 
+	namespace {
+		void AssertSaveStateToDirectoryWithCheckpointingWithDifferentialState(uint32_t maxStateDeltaSnapshots, bool expectedSkip) {
+			// Arrange:
+			test::TempDirectoryGuard tempDir;
+			auto dataDirectory = config::CatapultDataDirectory(tempDir.name());
+			auto nodeConfig = config::NodeConfiguration::Uninitialized();
+			nodeConfig.EnableCacheDatabaseStorage = false;
+			nodeConfig.MaxStateDeltaSnapshots = maxStateDeltaSnapshots;
+
+			// - seed the cache state with two differential state snapshots
+			auto catapultCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+			PrepareAndSaveDifferentialState(dataDirectory.dir("state"), dataDirectory.dir("state.tmp"), catapultCache);
+
+			// Act: save the state
+			constexpr auto SaveState = SaveStateToDirectoryWithCheckpointing;
+			SaveState(dataDirectory, nodeConfig, catapultCache, CreateDeterministicSupplementalData().ChainScore);
+
+			// Assert: differential state is only folded into a new base when state is saved
+			EXPECT_EQ(expectedSkip ? 2u : 0u, CountStateDeltaSnapshots(dataDirectory.dir("state")));
+			EXPECT_EQ(!expectedSkip, std::filesystem::exists(dataDirectory.rootDir().file("commit_step.dat")));
+		}
+	}
+
+	TEST(TEST_CLASS, SaveStateToDirectoryWithCheckpointing_SkipsSaveWhenDifferentialStateIsCurrent) {
+		AssertSaveStateToDirectoryWithCheckpointingWithDifferentialState(3, true);
+	}
+
+	TEST(TEST_CLASS, SaveStateToDirectoryWithCheckpointing_CompactsDifferentialStateWhenMaxSnapshotsAreSaved) {
+		AssertSaveStateToDirectoryWithCheckpointingWithDifferentialState(2, false);
+	}
+
+	TEST(TEST_CLASS, SaveStateToDirectoryWithCheckpointing_CompactsDifferentialStateWhenDifferentialStateIsDisabled) {
+		AssertSaveStateToDirectoryWithCheckpointingWithDifferentialState(0, false);
+	}
+
 	TEST(TEST_CLASS, SaveStateToDirectoryWithCheckpointing_CommitStepIsAllUpdatedWhenCatapultCacheDeltaSaveSucceeds) {
 		// Arrange:
 		test::TempDirectoryGuard tempDir;
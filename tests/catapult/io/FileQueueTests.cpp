@@ -770,6 +770,157 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region FileQueueReader - read (batch)
+
+	namespace {
+		template<typename TTraits>
+		std::vector<std::vector<uint8_t>> WriteMessageFiles(ReaderTestContext<TTraits>& context, uint64_t startIndex, uint64_t endIndex) {
+			std::vector<std::vector<uint8_t>> buffers;
+			for (auto id = startIndex; id < endIndex; ++id) {
+				std::ostringstream out;
+				out << utils::HexFormat(id) << ".dat";
+				buffers.push_back(test::GenerateRandomVector(15 + id % 10));
+				context.write(out.str(), buffers.back());
+			}
+
+			return buffers;
+		}
+
+		template<typename TTraits>
+		void AssertCanReadBatch(size_t maxMessages, size_t expectedNumMessages) {
+			// Arrange:
+			ReaderTestContext<TTraits> context;
+			context.setIndexes(120, 115);
+			auto writeBuffers = WriteMessageFiles(context, 115, 120);
+
+			// Act:
+			auto numCalls = 0u;
+			std::vector<std::vector<uint8_t>> readBuffers;
+			auto result = context.reader().tryReadNextMessages(maxMessages, [&numCalls, &readBuffers](const auto& buffers) {
+				++numCalls;
+				readBuffers = buffers;
+				return true;
+			});
+
+			// Assert:
+			EXPECT_TRUE(result);
+			EXPECT_EQ(1u, numCalls);
+			auto expectedBuffersEnd = writeBuffers.cbegin() + static_cast<int>(expectedNumMessages);
+			EXPECT_EQ(decltype(writeBuffers)(writeBuffers.cbegin(), expectedBuffersEnd), readBuffers);
+
+			// - processed data files should have been deleted
+			EXPECT_EQ(2u + 5 - expectedNumMessages, context.countFiles());
+			AssertIndexFiles(context, 120, 115 + expectedNumMessages);
+		}
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CannotReadBatchWhenReaderIndexIsEqualToWriterIndex) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 120);
+
+		// Act:
+		auto numCalls = 0u;
+		auto result = context.reader().tryReadNextMessages(10, [&numCalls](const auto&) {
+			++numCalls;
+			return true;
+		});
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(0u, numCalls);
+		AssertIndexFiles(context, 120, 120);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CanReadBatchContainingSingleMessage) {
+		AssertCanReadBatch<TTraits>(1, 1);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CanReadBatchContainingAtMostMaxMessages) {
+		AssertCanReadBatch<TTraits>(3, 3);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CanReadBatchContainingAllPendingMessagesWhenFewerThanMaxMessages) {
+		AssertCanReadBatch<TTraits>(10, 5);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(ReadBatchDoesNotConsumeAnyMessagesWhenPredicateReturnsFalse) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 115);
+		auto writeBuffers = WriteMessageFiles(context, 115, 120);
+
+		// Act:
+		std::vector<std::vector<uint8_t>> readBuffers;
+		auto result = context.reader().tryReadNextMessages(10, [&readBuffers](const auto& buffers) {
+			readBuffers = buffers;
+			return false;
+		});
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(writeBuffers, readBuffers);
+
+		EXPECT_EQ(7u, context.countFiles());
+		AssertIndexFiles(context, 120, 115);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(ReadBatchPartialConsumesOnlyProcessedMessages) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 115);
+		auto writeBuffers = WriteMessageFiles(context, 115, 120);
+
+		// Act:
+		std::vector<std::vector<uint8_t>> readBuffers;
+		auto result = context.reader().tryReadNextMessagesPartial(10, [&readBuffers](const auto& buffers) {
+			readBuffers = buffers;
+			return 2u;
+		});
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(writeBuffers, readBuffers);
+
+		// - only processed data files should have been deleted
+		EXPECT_EQ(5u, context.countFiles());
+		AssertIndexFiles(context, 120, 117);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(ReadBatchPartialConsumesAllMessagesWhenAllAreProcessed) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 115);
+		WriteMessageFiles(context, 115, 120);
+
+		// Act:
+		auto result = context.reader().tryReadNextMessagesPartial(10, [](const auto& buffers) {
+			return buffers.size();
+		});
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(2u, context.countFiles());
+		AssertIndexFiles(context, 120, 120);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(ReadBatchDoesNotConsumeAnyMessagesWhenProcessingThrows) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 115);
+		WriteMessageFiles(context, 115, 120);
+
+		// Act + Assert:
+		EXPECT_THROW(context.reader().tryReadNextMessagesPartial(10, [](const auto&) -> size_t {
+			CATAPULT_THROW_RUNTIME_ERROR("processing failed");
+		}), catapult_runtime_error);
+
+		EXPECT_EQ(7u, context.countFiles());
+		AssertIndexFiles(context, 120, 115);
+	}
+
+	// endregion
+
 	// region FileQueueReader - skip
 
 	namespace {
@@ -824,4 +975,503 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region segments - writer
+
+	namespace {
+		constexpr uint64_t Max_Segment_Size = 100;
+
+		class SegmentQueueTestContext : public BasicQueueTestContext<DefaultTraits> {
+		public:
+			SegmentQueueTestContext()
+					: BasicQueueTestContext<DefaultTraits>("q")
+					, m_reader(DefaultTraits::CreateReader(directory().generic_string()))
+			{}
+
+		public:
+			FileQueueReader& reader() {
+				return m_reader;
+			}
+
+			std::unique_ptr<FileQueueWriter> createWriter() {
+				return std::make_unique<FileQueueWriter>(directory().generic_string(), "index.dat", Max_Segment_Size);
+			}
+
+			std::unique_ptr<FileQueueWriter> createWriter(uint64_t maxPendingSize, const utils::TimeSpan& maxPendingDuration) {
+				FileQueueSegmentOptions segmentOptions{ Max_Segment_Size, maxPendingSize, maxPendingDuration };
+				return std::make_unique<FileQueueWriter>(directory().generic_string(), "index.dat", segmentOptions);
+			}
+
+			std::vector<std::vector<uint8_t>> writeMessages(FileQueueWriter& writer, size_t count, size_t messageSize) {
+				std::vector<std::vector<uint8_t>> messages;
+				for (auto i = 0u; i < count; ++i) {
+					messages.push_back(test::GenerateRandomVector(messageSize));
+
+					// - split each message across multiple writes
+					auto halfSize = messageSize / 2;
+					writer.write({ messages.back().data(), halfSize });
+					writer.write({ messages.back().data() + halfSize, messageSize - halfSize });
+					writer.flush();
+				}
+
+				return messages;
+			}
+
+			std::vector<uint8_t> readNextMessage() {
+				std::vector<uint8_t> readBuffer;
+				EXPECT_TRUE(m_reader.tryReadNextMessage([&readBuffer](const auto& buffer) {
+					readBuffer = buffer;
+				}));
+				return readBuffer;
+			}
+
+		private:
+			FileQueueReader m_reader;
+		};
+	}
+
+	TEST(TEST_CLASS, SegmentWriterAppendsMultipleMessagesToSingleSegment) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto pWriter = context.createWriter();
+
+		// Act:
+		auto messages = context.writeMessages(*pWriter, 3, 20);
+
+		// Assert: index.dat, index_reader.dat, single segment
+		EXPECT_EQ(3u, context.countFiles());
+		EXPECT_EQ(3u, context.readIndexWriterFile());
+
+		auto segmentContents = context.readAll("0000000000000000.seg");
+		ASSERT_EQ(3u * (sizeof(uint32_t) + 20), segmentContents.size());
+		for (auto i = 0u; i < messages.size(); ++i) {
+			const auto* pRecord = segmentContents.data() + i * (sizeof(uint32_t) + 20);
+			EXPECT_EQ(20u, reinterpret_cast<const uint32_t&>(*pRecord)) << i;
+			EXPECT_EQ(messages[i], std::vector<uint8_t>(pRecord + sizeof(uint32_t), pRecord + sizeof(uint32_t) + 20)) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, SegmentWriterFlushWithoutWriteHasNoEffect) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto pWriter = context.createWriter();
+
+		// Act:
+		pWriter->flush();
+
+		// Assert: index.dat, index_reader.dat
+		EXPECT_EQ(2u, context.countFiles());
+		EXPECT_EQ(0u, context.readIndexWriterFile());
+	}
+
+	TEST(TEST_CLASS, SegmentWriterStartsNewSegmentWhenMaxSegmentSizeIsReached) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto pWriter = context.createWriter();
+
+		// Act: each record is 34 bytes, so a segment can contain at most three records
+		context.writeMessages(*pWriter, 7, 30);
+
+		// Assert: closed segments are terminated by an end marker
+		EXPECT_EQ(5u, context.countFiles());
+		EXPECT_EQ(7u, context.readIndexWriterFile());
+
+		auto segmentContents = context.readAll("0000000000000000.seg");
+		ASSERT_EQ(3u * 34 + sizeof(uint32_t), segmentContents.size());
+		EXPECT_EQ(0xFFFF'FFFFu, reinterpret_cast<const uint32_t&>(segmentContents[3 * 34]));
+
+		EXPECT_EQ(3u * 34 + sizeof(uint32_t), context.readAll("0000000000000003.seg").size());
+		EXPECT_EQ(1u * 34, context.readAll("0000000000000006.seg").size());
+	}
+
+	TEST(TEST_CLASS, SegmentWriterContinuesActiveSegmentAfterRestart) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		context.writeMessages(*context.createWriter(), 2, 20);
+
+		// Act:
+		context.writeMessages(*context.createWriter(), 2, 20);
+
+		// Assert:
+		EXPECT_EQ(3u, context.countFiles());
+		EXPECT_EQ(4u, context.readIndexWriterFile());
+
+		EXPECT_EQ(4u * 24, context.readAll("0000000000000000.seg").size());
+	}
+
+	TEST(TEST_CLASS, SegmentWriterStartsNewSegmentAfterRestartWhenActiveSegmentIsFull) {
+		// Arrange: each record is 34 bytes, so a segment can contain at most three records
+		SegmentQueueTestContext context;
+		context.writeMessages(*context.createWriter(), 3, 30);
+
+		// Act:
+		context.writeMessages(*context.createWriter(), 2, 30);
+
+		// Assert:
+		EXPECT_EQ(4u, context.countFiles());
+		EXPECT_EQ(5u, context.readIndexWriterFile());
+
+		EXPECT_EQ(3u * 34 + sizeof(uint32_t), context.readAll("0000000000000000.seg").size());
+		EXPECT_EQ(2u * 34, context.readAll("0000000000000003.seg").size());
+	}
+
+	TEST(TEST_CLASS, SegmentWriterOverwritesUncommittedSegmentDataAfterRestart) {
+		// Arrange: simulate data that was appended to segment but never made visible by an index update
+		SegmentQueueTestContext context;
+		context.writeMessages(*context.createWriter(), 2, 20);
+		{
+			RawFile segmentFile((context.directory() / "0000000000000000.seg").generic_string(), OpenMode::Read_Append);
+			segmentFile.seek(segmentFile.size());
+			segmentFile.write(test::GenerateRandomVector(50));
+		}
+
+		// Act:
+		context.writeMessages(*context.createWriter(), 1, 25);
+
+		// Assert:
+		EXPECT_EQ(3u, context.readIndexWriterFile());
+		EXPECT_EQ(2u * 24 + 29, context.readAll("0000000000000000.seg").size());
+	}
+
+	// endregion
+
+	// region segments - group commit
+
+	TEST(TEST_CLASS, SegmentWriterDefersCommitUntilMaxPendingSizeIsReached) {
+		// Arrange: each record is 24 bytes
+		SegmentQueueTestContext context;
+		auto pWriter = context.createWriter(60, utils::TimeSpan::FromHours(1));
+
+		// Act + Assert: messages are appended but not visible
+		context.writeMessages(*pWriter, 2, 20);
+		EXPECT_EQ(2u * 24, context.readAll("0000000000000000.seg").size());
+		EXPECT_EQ(0u, context.readIndexWriterFile());
+		EXPECT_EQ(0u, context.reader().pending());
+
+		// Act + Assert: all pending messages are committed together
+		context.writeMessages(*pWriter, 1, 20);
+		EXPECT_EQ(3u, context.readIndexWriterFile());
+		EXPECT_EQ(3u, context.reader().pending());
+	}
+
+	TEST(TEST_CLASS, SegmentWriterCommitsPendingMessagesWhenSegmentIsClosed) {
+		// Arrange: each record is 34 bytes, so a segment can contain at most three records
+		SegmentQueueTestContext context;
+		auto pWriter = context.createWriter(1000, utils::TimeSpan::FromHours(1));
+
+		// Act:
+		context.writeMessages(*pWriter, 4, 30);
+
+		// Assert: messages in closed segment are committed
+		EXPECT_EQ(3u, context.readIndexWriterFile());
+		EXPECT_TRUE(context.exists("0000000000000003.seg"));
+	}
+
+	TEST(TEST_CLASS, SegmentWriterCommitsPendingMessagesOnFlushWhenMaxPendingDurationIsExceeded) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto pWriter = context.createWriter(1000, utils::TimeSpan::FromMilliseconds(10));
+		context.writeMessages(*pWriter, 1, 20);
+
+		// Sanity:
+		EXPECT_EQ(0u, context.readIndexWriterFile());
+
+		// Act:
+		test::Sleep(20);
+		context.writeMessages(*pWriter, 1, 20);
+
+		// Assert:
+		EXPECT_EQ(2u, context.readIndexWriterFile());
+	}
+
+	TEST(TEST_CLASS, SegmentWriterCommitExpiredCommitsPendingMessagesWhenMaxPendingDurationIsExceeded) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto pWriter = context.createWriter(1000, utils::TimeSpan::FromMilliseconds(10));
+		context.writeMessages(*pWriter, 2, 20);
+
+		// Act:
+		test::Sleep(20);
+		pWriter->commitExpired();
+
+		// Assert:
+		EXPECT_EQ(2u, context.readIndexWriterFile());
+	}
+
+	TEST(TEST_CLASS, SegmentWriterCommitExpiredDoesNotCommitPendingMessagesBeforeMaxPendingDurationIsExceeded) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto pWriter = context.createWriter(1000, utils::TimeSpan::FromHours(1));
+		context.writeMessages(*pWriter, 2, 20);
+
+		// Act:
+		pWriter->commitExpired();
+
+		// Assert:
+		EXPECT_EQ(0u, context.readIndexWriterFile());
+	}
+
+	TEST(TEST_CLASS, SegmentWriterCommitsPendingMessagesWhenDestroyed) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto pWriter = context.createWriter(1000, utils::TimeSpan::FromHours(1));
+		auto messages = context.writeMessages(*pWriter, 2, 20);
+
+		// Act:
+		pWriter.reset();
+
+		// Assert:
+		EXPECT_EQ(2u, context.readIndexWriterFile());
+		EXPECT_EQ(messages[0], context.readNextMessage());
+		EXPECT_EQ(messages[1], context.readNextMessage());
+	}
+
+	// endregion
+
+	// region segments - reader
+
+	TEST(TEST_CLASS, ReaderCanReadAllMessagesFromSegments) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto messages = context.writeMessages(*context.createWriter(), 7, 30);
+
+		// Act + Assert:
+		for (auto i = 0u; i < messages.size(); ++i)
+			EXPECT_EQ(messages[i], context.readNextMessage()) << i;
+
+		EXPECT_FALSE(context.reader().tryReadNextMessage([](const auto&) {}));
+		EXPECT_EQ(7u, context.readIndexReaderFile());
+	}
+
+	TEST(TEST_CLASS, ReaderCanReadMessagesFromActiveSegmentAsTheyAreWritten) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto pWriter = context.createWriter();
+
+		// Act + Assert:
+		for (auto i = 0u; i < 3; ++i) {
+			auto messages = context.writeMessages(*pWriter, 1, 20);
+			EXPECT_EQ(messages[0], context.readNextMessage()) << i;
+		}
+
+		EXPECT_EQ(3u, context.countFiles());
+		EXPECT_EQ(3u, context.readIndexReaderFile());
+	}
+
+	TEST(TEST_CLASS, ReaderCanFollowWriterAcrossSegmentsAsMessagesAreWritten) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto pWriter = context.createWriter();
+
+		// Act + Assert: reader reaches end of each segment before writer starts next one
+		for (auto i = 0u; i < 7; ++i) {
+			auto messages = context.writeMessages(*pWriter, 1, 30);
+			EXPECT_EQ(messages[0], context.readNextMessage()) << i;
+		}
+
+		EXPECT_EQ(7u, context.readIndexReaderFile());
+		EXPECT_FALSE(context.exists("0000000000000003.seg"));
+		EXPECT_TRUE(context.exists("0000000000000006.seg"));
+	}
+
+	TEST(TEST_CLASS, ReaderCanReadMessagesAppendedToSegmentAfterWriterRestart) {
+		// Arrange: reader consumes all messages, so segment is held open at its (uncommitted) end
+		SegmentQueueTestContext context;
+		context.writeMessages(*context.createWriter(), 2, 20);
+		context.readNextMessage();
+		context.readNextMessage();
+
+		{
+			RawFile segmentFile((context.directory() / "0000000000000000.seg").generic_string(), OpenMode::Read_Append);
+			segmentFile.seek(segmentFile.size());
+			segmentFile.write(test::GenerateRandomVector(50));
+		}
+
+		// Act:
+		auto messages = context.writeMessages(*context.createWriter(), 2, 25);
+
+		// Assert:
+		EXPECT_EQ(messages[0], context.readNextMessage());
+		EXPECT_EQ(messages[1], context.readNextMessage());
+	}
+
+	TEST(TEST_CLASS, ReaderDeletesSegmentsOnlyAfterAllMessagesHaveBeenConsumed) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		context.writeMessages(*context.createWriter(), 7, 30);
+
+		// Act: read all messages from first segment
+		for (auto i = 0u; i < 3; ++i)
+			context.readNextMessage();
+
+		// Assert: first segment is retained
+		EXPECT_TRUE(context.exists("0000000000000000.seg"));
+
+		// Act: read first message from second segment
+		context.readNextMessage();
+
+		// Assert: first segment is deleted
+		EXPECT_EQ(4u, context.countFiles());
+		EXPECT_FALSE(context.exists("0000000000000000.seg"));
+		EXPECT_TRUE(context.exists("0000000000000003.seg"));
+		EXPECT_TRUE(context.exists("0000000000000006.seg"));
+	}
+
+	TEST(TEST_CLASS, ReaderCanResumeReadingFromMiddleOfSegmentAfterRestart) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto messages = context.writeMessages(*context.createWriter(), 7, 30);
+		context.readNextMessage();
+		context.readNextMessage();
+		context.readNextMessage();
+		context.readNextMessage();
+
+		// Act:
+		FileQueueReader reader(context.directory().generic_string());
+		std::vector<std::vector<uint8_t>> readMessages;
+		while (reader.tryReadNextMessage([&readMessages](const auto& buffer) { readMessages.push_back(buffer); })) {}
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>(messages.cbegin() + 4, messages.cend()), readMessages);
+		EXPECT_EQ(7u, context.readIndexReaderFile());
+	}
+
+	TEST(TEST_CLASS, ReaderDoesNotAdvanceInSegmentWhenMessageIsNotProcessed) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto messages = context.writeMessages(*context.createWriter(), 2, 20);
+
+		// Act:
+		std::vector<uint8_t> readBuffer;
+		auto result = context.reader().tryReadNextMessageConditional([&readBuffer](const auto& buffer) {
+			readBuffer = buffer;
+			return false;
+		});
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(messages[0], readBuffer);
+		EXPECT_EQ(0u, context.readIndexReaderFile());
+
+		// - message can be read again
+		EXPECT_EQ(messages[0], context.readNextMessage());
+		EXPECT_EQ(messages[1], context.readNextMessage());
+	}
+
+	TEST(TEST_CLASS, ReaderDoesNotAdvanceAcrossSegmentsWhenMessagesAreNotProcessed) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto messages = context.writeMessages(*context.createWriter(), 5, 30);
+		context.readNextMessage();
+		context.readNextMessage();
+
+		// Act: read messages spanning two segments
+		auto result = context.reader().tryReadNextMessages(3, [](const auto&) {
+			return false;
+		});
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(2u, context.readIndexReaderFile());
+
+		// - messages can be read again
+		for (auto i = 2u; i < messages.size(); ++i)
+			EXPECT_EQ(messages[i], context.readNextMessage()) << i;
+	}
+
+	TEST(TEST_CLASS, ReaderCanSkipMessagesInSegments) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto messages = context.writeMessages(*context.createWriter(), 7, 30);
+
+		// Act:
+		context.reader().skip(5);
+
+		// Assert:
+		EXPECT_EQ(5u, context.readIndexReaderFile());
+		EXPECT_EQ(messages[5], context.readNextMessage());
+		EXPECT_FALSE(context.exists("0000000000000000.seg"));
+	}
+
+	TEST(TEST_CLASS, ReaderIgnoresStaleSegmentDataAfterWriterRestart) {
+		// Arrange: simulate data that was appended to segment but never made visible by an index update
+		SegmentQueueTestContext context;
+		context.writeMessages(*context.createWriter(), 2, 20);
+		{
+			RawFile segmentFile((context.directory() / "0000000000000000.seg").generic_string(), OpenMode::Read_Append);
+			segmentFile.seek(segmentFile.size());
+			segmentFile.write(test::GenerateRandomVector(50));
+		}
+
+		auto messages = context.writeMessages(*context.createWriter(), 2, 25);
+
+		// Act:
+		context.reader().skip(2);
+
+		// Assert:
+		EXPECT_EQ(messages[0], context.readNextMessage());
+		EXPECT_EQ(messages[1], context.readNextMessage());
+	}
+
+	TEST(TEST_CLASS, ReaderCanReadBatchSpanningMultipleSegments) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto messages = context.writeMessages(*context.createWriter(), 7, 30);
+
+		// Act:
+		std::vector<std::vector<uint8_t>> readBuffers;
+		auto result = context.reader().tryReadNextMessages(5, [&readBuffers](const auto& buffers) {
+			readBuffers = buffers;
+			return true;
+		});
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(decltype(messages)(messages.cbegin(), messages.cbegin() + 5), readBuffers);
+		EXPECT_EQ(5u, context.readIndexReaderFile());
+		EXPECT_FALSE(context.exists("0000000000000000.seg"));
+		EXPECT_EQ(messages[5], context.readNextMessage());
+	}
+
+	TEST(TEST_CLASS, ReaderCanConsumeLeadingMessagesOfBatchSpanningMultipleSegments) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto messages = context.writeMessages(*context.createWriter(), 7, 30);
+		context.readNextMessage();
+
+		// Act:
+		auto result = context.reader().tryReadNextMessagesPartial(5, [](const auto&) {
+			return 3u;
+		});
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(4u, context.readIndexReaderFile());
+
+		// - unprocessed messages can be read again
+		for (auto i = 4u; i < messages.size(); ++i)
+			EXPECT_EQ(messages[i], context.readNextMessage()) << i;
+	}
+
+	TEST(TEST_CLASS, ReaderDoesNotRemoveSegmentsWhenBatchSpanningMultipleSegmentsIsNotProcessed) {
+		// Arrange:
+		SegmentQueueTestContext context;
+		auto messages = context.writeMessages(*context.createWriter(), 7, 30);
+
+		// Act:
+		auto result = context.reader().tryReadNextMessages(5, [](const auto&) {
+			return false;
+		});
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(0u, context.readIndexReaderFile());
+		EXPECT_EQ(5u, context.countFiles());
+
+		// - all messages can be read again
+		for (auto i = 0u; i < messages.size(); ++i)
+			EXPECT_EQ(messages[i], context.readNextMessage()) << i;
+	}
+
+	// endregion
 }}
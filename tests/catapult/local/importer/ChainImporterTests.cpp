@@ -58,6 +58,9 @@ namespace catapult { namespace local {
 				CATAPULT_THROW_RUNTIME_ERROR("notifyDropBlocksAfter - not supported in mock");
 			}
 
+			void flush() override
+			{}
+
 		private:
 			std::vector<Height>& m_heights;
 		};
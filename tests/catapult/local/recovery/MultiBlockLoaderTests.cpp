@@ -287,6 +287,26 @@ namespace catapult { namespace local {
 		EXPECT_EQ(expectedHeights, context.statusHeights());
 	}
 
+	TEST(TEST_CLASS, LoadBlockChainLoadsMultipleBlocksWhenStorageHeightIsGreaterThanReadAheadWindow) {
+		// Arrange: create a storage with more blocks than can be read ahead of execution
+		LoadBlockChainTestContext context;
+		context.setStorageChainHeight(Height(50));
+
+		// Act:
+		auto score = context.load(Height(2));
+
+		// Assert:
+		std::vector<Height> expectedHeights;
+		for (auto height = Height(2); height <= Height(50); height = height + Height(1))
+			expectedHeights.push_back(height);
+
+		EXPECT_EQ(model::ChainScore(CalculateExpectedScore(50)), score);
+		EXPECT_EQ(49u, context.observerBlockHeights().size());
+		EXPECT_EQ(expectedHeights, context.observerBlockHeights());
+		EXPECT_EQ(expectedHeights, context.factoryHeights());
+		EXPECT_EQ(expectedHeights, context.statusHeights());
+	}
+
 	// endregion
 
 	// region LoadBlockChain - state enabled
@@ -112,6 +112,7 @@ namespace catapult { namespace local {
 		// Assert:
 		const auto& capturedBlockElements = subscriber.copiedBlockElements();
 		EXPECT_EQ(0u, capturedBlockElements.size());
+		EXPECT_EQ(0u, subscriber.numFlushes());
 	}
 
 	TEST(TEST_CLASS, BlockChangeNotificationsAreRaisedWhenPreviousExecutionIsNotDetected_WithoutStatement) {
@@ -128,6 +129,7 @@ namespace catapult { namespace local {
 		EXPECT_EQ(Height(1), capturedBlockElements[0]->Block.Height);
 
 		EXPECT_FALSE(capturedBlockElements[0]->OptionalStatement);
+		EXPECT_EQ(1u, subscriber.numFlushes());
 	}
 
 	TEST(TEST_CLASS, BlockChangeNotificationsAreRaisedWhenPreviousExecutionIsNotDetected_WithStatement) {
@@ -146,6 +148,7 @@ namespace catapult { namespace local {
 
 		ASSERT_TRUE(capturedBlockElements[0]->OptionalStatement);
 		test::AssertEqual(*pBlockStatement, *capturedBlockElements[0]->OptionalStatement);
+		EXPECT_EQ(1u, subscriber.numFlushes());
 	}
 
 	// endregion
@@ -231,6 +231,13 @@ namespace catapult { namespace subscribers {
 				return subscribers::ReadAll({ context.queuePath(), "index_r.dat", "index.dat" }, subscriber, readNextMessage);
 			}
 		};
+
+		struct ReadAllPendingTraits {
+			template<typename TSubscriber, typename TMessageReader>
+			static void ReadAll(QueueTestContext& context, TSubscriber& subscriber, TMessageReader readNextMessage) {
+				return subscribers::ReadAllPending(context.reader(), context.queuePath(), subscriber, readNextMessage, 1);
+			}
+		};
 	}
 
 #define READ_ALL_FILE_BASED_TEST(TEST_NAME) \
@@ -239,6 +246,7 @@ namespace catapult { namespace subscribers {
 	TEST(TEST_CLASS, TEST_NAME##_MessageQueueDescriptor) { \
 		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllMessageQueueDescriptorTraits>(); \
 	} \
+	TEST(TEST_CLASS, TEST_NAME##_Pending) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllPendingTraits>(); } \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	READ_ALL_FILE_BASED_TEST(ReadAllFileQueue_CanReadZero) {
@@ -345,4 +353,185 @@ namespace catapult { namespace subscribers {
 	}
 
 	// endregion
+
+	// region ReadAll (batched)
+
+	namespace {
+		struct ReadAllBatchedFileQueueTraits {
+			template<typename TSubscriber, typename TMessageReader>
+			static void ReadAll(QueueTestContext& context, TSubscriber& subscriber, TMessageReader readNextMessage, size_t maxBatchSize) {
+				return subscribers::ReadAll(context.reader(), subscriber, readNextMessage, maxBatchSize);
+			}
+
+			static size_t Pending(QueueTestContext& context) {
+				return context.reader().pending();
+			}
+		};
+
+		struct ReadAllBatchedMessageQueueDescriptorTraits {
+			template<typename TSubscriber, typename TMessageReader>
+			static void ReadAll(QueueTestContext& context, TSubscriber& subscriber, TMessageReader readNextMessage, size_t maxBatchSize) {
+				MessageQueueDescriptor descriptor{ context.queuePath(), "index_r.dat", "index.dat" };
+				return subscribers::ReadAll(descriptor, subscriber, readNextMessage, maxBatchSize);
+			}
+
+			static size_t Pending(QueueTestContext& context) {
+				return io::FileQueueReader(context.queuePath(), "index_r.dat", "index.dat").pending();
+			}
+		};
+
+		std::vector<std::vector<uint8_t>> WriteRandomNotificationBuffers(QueueTestContext& context, size_t count) {
+			std::vector<std::vector<uint8_t>> notificationBuffers;
+			for (auto i = 0u; i < count; ++i) {
+				notificationBuffers.push_back(test::GenerateRandomVector(100 + i));
+				context.write(notificationBuffers.back());
+			}
+
+			return notificationBuffers;
+		}
+	}
+
+#define READ_ALL_BATCHED_FILE_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_FileQueue) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllBatchedFileQueueTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_MessageQueueDescriptor) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllBatchedMessageQueueDescriptorTraits>(); \
+	} \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	READ_ALL_BATCHED_FILE_BASED_TEST(ReadAllBatched_CanReadZero) {
+		// Arrange:
+		QueueTestContext context;
+
+		MockBufferSubscriber subscriber;
+
+		// Act:
+		TTraits::ReadAll(context, subscriber, ReadNextBuffer, 2);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Breadcrumb>(), subscriber.breadcrumbs());
+		EXPECT_TRUE(subscriber.notifications().empty());
+	}
+
+	READ_ALL_BATCHED_FILE_BASED_TEST(ReadAllBatched_FlushesOncePerBatch) {
+		// Arrange:
+		QueueTestContext context;
+		auto notificationBuffers = WriteRandomNotificationBuffers(context, 5);
+
+		MockBufferSubscriber subscriber;
+
+		// Act:
+		TTraits::ReadAll(context, subscriber, ReadNextBuffer, 2);
+
+		// Assert:
+		std::vector<Breadcrumb> expectedBreadcrumbs{
+			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Flush
+		};
+		EXPECT_EQ(expectedBreadcrumbs, subscriber.breadcrumbs());
+		EXPECT_EQ(notificationBuffers, subscriber.notifications());
+		EXPECT_EQ(0u, TTraits::Pending(context));
+	}
+
+	READ_ALL_BATCHED_FILE_BASED_TEST(ReadAllBatched_CanReadMultipleWithMultipleNotificationsPerFile) {
+		// Arrange:
+		auto notificationBuffer1 = test::GenerateRandomVector(141);
+		auto notificationBuffer2 = test::GenerateRandomVector(132);
+		auto notificationBuffer3 = test::GenerateRandomVector(144);
+
+		QueueTestContext context;
+		context.write({ notificationBuffer1, notificationBuffer2 });
+		context.write(notificationBuffer3);
+
+		MockBufferSubscriber subscriber;
+
+		// Act:
+		TTraits::ReadAll(context, subscriber, ReadNextBuffer, 10);
+
+		// Assert:
+		std::vector<Breadcrumb> expectedBreadcrumbs{ Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush };
+		EXPECT_EQ(expectedBreadcrumbs, subscriber.breadcrumbs());
+
+		const auto& notifications = subscriber.notifications();
+		ASSERT_EQ(3u, notifications.size());
+		EXPECT_EQ(notificationBuffer1, notifications[0]);
+		EXPECT_EQ(notificationBuffer2, notifications[1]);
+		EXPECT_EQ(notificationBuffer3, notifications[2]);
+	}
+
+	READ_ALL_BATCHED_FILE_BASED_TEST(ReadAllBatched_ConsumesOnlyMessagesPrecedingFailedMessage) {
+		// Arrange:
+		QueueTestContext context;
+		WriteRandomNotificationBuffers(context, 5);
+
+		MockBufferSubscriber subscriber;
+		auto readNextBufferOrThrow = [](auto& inputStream, auto& subscriberRef) {
+			if (3 == subscriberRef.notifications().size())
+				CATAPULT_THROW_RUNTIME_ERROR("processing failed");
+
+			ReadNextBuffer(inputStream, subscriberRef);
+		};
+
+		// Act:
+		EXPECT_THROW(TTraits::ReadAll(context, subscriber, readNextBufferOrThrow, 4), catapult_runtime_error);
+
+		// Assert: messages preceding failed message were flushed and consumed
+		std::vector<Breadcrumb> expectedBreadcrumbs{
+			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush
+		};
+		EXPECT_EQ(expectedBreadcrumbs, subscriber.breadcrumbs());
+		EXPECT_EQ(2u, TTraits::Pending(context));
+	}
+
+	READ_ALL_BATCHED_FILE_BASED_TEST(ReadAllBatched_ResumesAtFailedMessage) {
+		// Arrange:
+		QueueTestContext context;
+		auto notificationBuffers = WriteRandomNotificationBuffers(context, 5);
+
+		MockBufferSubscriber subscriber1;
+		auto readNextBufferOrThrow = [](auto& inputStream, auto& subscriberRef) {
+			if (3 == subscriberRef.notifications().size())
+				CATAPULT_THROW_RUNTIME_ERROR("processing failed");
+
+			ReadNextBuffer(inputStream, subscriberRef);
+		};
+		EXPECT_THROW(TTraits::ReadAll(context, subscriber1, readNextBufferOrThrow, 4), catapult_runtime_error);
+
+		MockBufferSubscriber subscriber2;
+
+		// Act:
+		TTraits::ReadAll(context, subscriber2, ReadNextBuffer, 4);
+
+		// Assert: only failed and subsequent messages were processed again
+		std::vector<Breadcrumb> expectedBreadcrumbs{ Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush };
+		EXPECT_EQ(expectedBreadcrumbs, subscriber2.breadcrumbs());
+		auto expectedNotifications = decltype(notificationBuffers)(notificationBuffers.cbegin() + 3, notificationBuffers.cend());
+		EXPECT_EQ(expectedNotifications, subscriber2.notifications());
+		EXPECT_EQ(0u, TTraits::Pending(context));
+	}
+
+	READ_ALL_BATCHED_FILE_BASED_TEST(ReadAllBatched_DoesNotConsumeAnyMessagesWhenFlushFails) {
+		// Arrange:
+		QueueTestContext context;
+		WriteRandomNotificationBuffers(context, 5);
+
+		class ThrowingFlushSubscriber : public MockBufferSubscriberWithoutFlush {
+		public:
+			void flush() {
+				CATAPULT_THROW_RUNTIME_ERROR("flush failed");
+			}
+		};
+
+		ThrowingFlushSubscriber subscriber;
+
+		// Act:
+		EXPECT_THROW(TTraits::ReadAll(context, subscriber, ReadNextBuffer, 2), catapult_runtime_error);
+
+		// Assert:
+		EXPECT_EQ(2u, subscriber.notifications().size());
+		EXPECT_EQ(5u, TTraits::Pending(context));
+	}
+
+	// endregion
 }}
@@ -21,10 +21,11 @@
 
 #pragma once
 #include "catapult/model/NotificationPublisher.h"
+#include <atomic>
 
 namespace catapult { namespace mocks {
 
-	/// Mock notification publisher that counts the number of publish calls.
+	/// Mock notification publisher that (thread safely) counts the number of publish calls.
 	class MockNotificationPublisher : public model::NotificationPublisher {
 	public:
 		/// Creates a mock notification publisher.
@@ -43,6 +44,6 @@ namespace catapult { namespace mocks {
 		}
 
 	private:
-		mutable size_t m_numPublishCalls;
+		mutable std::atomic<size_t> m_numPublishCalls;
 	};
 }}